@@ -0,0 +1,332 @@
+// Micro and macro benchmarks with machine-readable output, for diffing commits
+// Usage: Bench [--csv] [name filter]
+//        Bench --check-allocs   (fails unless headless rounds are allocation-free)
+#include "../include/core/Random.h"
+#include "../include/core/HandEvaluator.h"
+#include "../include/game/BloodGambleGame.h"
+#include "../include/game/CheatAdvisor.h"
+#include "../include/ai/AIPlayer.h"
+#include "../include/ai/HandIndexer.h"
+#include "../include/ai/Mcts.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+
+// ===== ALLOCATION COUNTING =====
+// Every operator new in the process goes through here, including the equity
+// engine's worker threads; benchmarks report the delta per operation.
+namespace {
+std::atomic<uint64_t> allocationCount{0};
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC flags the free() below once a matching new is inlined next to it
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+const double MIN_SECONDS = 0.3;
+
+struct BenchResult {
+    std::string name;
+    uint64_t ops;
+    double nsPerOp;
+    double opsPerSec;
+    double allocsPerOp;
+};
+
+// Keeps results alive without letting the compiler drop the measured call
+volatile uint64_t sink = 0;
+
+// Runs fn in growing batches until MIN_SECONDS have passed
+template <typename Fn>
+BenchResult measure(const std::string& name, Fn fn) {
+    using Clock = std::chrono::steady_clock;
+    fn(); // Warm up caches and lazily built state
+
+    uint64_t ops = 0;
+    uint64_t batch = 1;
+    uint64_t allocsBefore = allocationCount;
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    while (elapsed < MIN_SECONDS) {
+        for (uint64_t i = 0; i < batch; i++) {
+            fn();
+        }
+        ops += batch;
+        batch *= 2;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    uint64_t allocs = allocationCount - allocsBefore;
+    return {name, ops, elapsed * 1e9 / ops, ops / elapsed, static_cast<double>(allocs) / ops};
+}
+
+std::vector<std::vector<Card>> randomHands(size_t count, unsigned int seed) {
+    Deck deck(seed);
+    std::vector<std::vector<Card>> hands(count);
+    for (auto& hand : hands) {
+        deck.reset();
+        hand = deck.draw(7);
+    }
+    return hands;
+}
+
+// A four-seat table dealt up to the given street
+GameState dealtState(unsigned int seed, int boardCards) {
+    GameState state(seed);
+    state.roundNumber = 1;
+    for (auto& player : state.players) {
+        Card first = state.deck.draw();
+        player.dealCards(first, state.deck.draw());
+    }
+    for (int i = 0; i < boardCards; i++) {
+        state.addBoardCard(state.deck.draw());
+    }
+    state.stage = boardCards == 0 ? GameStage::PRE_FLOP : boardCards == 3 ? GameStage::FLOP
+                : boardCards == 4 ? GameStage::TURN : GameStage::RIVER;
+    return state;
+}
+
+void printJson(const std::vector<BenchResult>& results, std::ostream& out) {
+    out << "[\n" << std::fixed;
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        out << "  {\"name\": \"" << r.name << "\", \"ops\": " << r.ops
+            << ", \"ns_per_op\": " << std::setprecision(2) << r.nsPerOp
+            << ", \"ops_per_sec\": " << std::setprecision(0) << r.opsPerSec
+            << ", \"allocs_per_op\": " << std::setprecision(3) << r.allocsPerOp << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+void printCsv(const std::vector<BenchResult>& results, std::ostream& out) {
+    out << "name,ops,ns_per_op,ops_per_sec,allocs_per_op\n" << std::fixed;
+    for (const auto& r : results) {
+        out << r.name << "," << r.ops << "," << std::setprecision(2) << r.nsPerOp << ","
+            << std::setprecision(0) << r.opsPerSec << "," << std::setprecision(3) << r.allocsPerOp << "\n";
+    }
+}
+
+// Counts heap allocations inside playRound only, over many headless games at
+// the default and full-ring table sizes, with and without a hand history, and
+// with one MctsPolicy seat on a short deadline; building each new game is not counted
+int checkRoundAllocations(const char* nullDevice) {
+    struct Case {
+        int seats;
+        bool logged;
+        bool search;
+        int rounds;
+    };
+    const Case CASES[] = {{DEFAULT_SEATS, false, false, 20000}, {DEFAULT_SEATS, true, false, 20000},
+                          {MAX_SEATS, false, false, 20000}, {MAX_SEATS, true, false, 20000},
+                          {DEFAULT_SEATS, false, true, 2000}};
+    bool clean = true;
+    for (const Case& check : CASES) {
+        const int ROUNDS = check.rounds;
+        bool logged = check.logged;
+        TableSetup table;
+        table.seats = check.seats;
+        if (check.search) {
+            table.mctsMask = seatBit(1);
+            table.mctsBudgetUs = 200;
+        }
+        HandHistory history;
+        if (logged) history.openWrite(nullDevice);
+        unsigned int seed = 1;
+        auto game = std::make_unique<BloodGambleGame>(seed, true, table);
+        if (logged) game->setHistory(&history);
+
+        uint64_t allocations = 0;
+        for (int round = 0; round < ROUNDS; round++) {
+            if (game->getState().gameOver()) {
+                game = std::make_unique<BloodGambleGame>(++seed, true, table);
+                if (logged) game->setHistory(&history);
+            }
+            uint64_t before = allocationCount;
+            sink += game->playRound().pot;
+            allocations += allocationCount - before;
+        }
+        std::cout << check.seats << " seats, " << (logged ? "logged" : "unlogged") << (check.search ? ", one MCTS seat" : "")
+                  << ": " << allocations
+                  << " allocations in " << ROUNDS << " rounds\n";
+        clean = clean && allocations == 0;
+    }
+    if (!clean) std::cerr << "FAIL: headless rounds must not allocate\n";
+    return clean ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+#ifdef _WIN32
+    const char* nullDevice = "NUL";
+#else
+    const char* nullDevice = "/dev/null";
+#endif
+    bool csv = false;
+    std::string filter;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--csv") csv = true;
+        else if (arg == "--check-allocs") return checkRoundAllocations(nullDevice);
+        else filter = arg;
+    }
+
+    std::vector<BenchResult> results;
+    auto run = [&](const std::string& name, auto fn) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) return;
+        std::cerr << "running " << name << "\n";
+        results.push_back(measure(name, fn));
+    };
+
+    // ===== MICRO =====
+    auto hands = randomHands(4096, 12345);
+    size_t handIndex = 0;
+    run("evaluator.evaluateHand", [&]() {
+        sink += HandEvaluator::evaluateHand(hands[handIndex++ & 4095]).strength;
+    });
+    run("evaluator.evaluate", [&]() {
+        sink += HandEvaluator::evaluate(hands[handIndex++ & 4095]);
+    });
+
+    Xoshiro256 xoshiro(1);
+    run("rng.xoshiro256", [&]() {
+        sink += xoshiro();
+    });
+    Philox4x32 philox(1);
+    run("rng.philox4x32", [&]() {
+        sink += philox();
+    });
+    run("rng.jump", [&]() {
+        xoshiro.jump();
+    });
+
+    Deck deck(1);
+    run("deck.reset", [&]() {
+        deck.reset();
+        sink += deck.size();
+    });
+    run("deck.shuffleRemaining", [&]() {
+        deck.shuffleRemaining();
+        sink += deck.size();
+    });
+    run("deck.draw", [&]() {
+        if (deck.size() < 9) deck.reset();
+        sink += deck.draw().index();
+    });
+    run("deck.draw2", [&]() {
+        if (deck.size() < 9) deck.reset();
+        sink += deck.draw(2).size();
+    });
+
+    for (int boardCards : {0, 3, 4, 5}) {
+        GameState state = dealtState(7, boardCards);
+        std::string street = boardCards == 0 ? "preflop" : boardCards == 3 ? "flop" : boardCards == 4 ? "turn" : "river";
+        run("ai.decideAction." + street, [&]() {
+            sink += static_cast<uint64_t>(AIPlayer::decideAction(state.players[1], state, BIG_BLIND, MIN_BET));
+        });
+        run("ai.quickStrength." + street, [&]() {
+            sink += static_cast<uint64_t>(AIPlayer::quickStrength(state.players[1], state) * 1000);
+        });
+        if (boardCards > 0) {
+            run("ai.handIndex." + street, [&]() {
+                sink += HandIndexer::index(state.players[1].handMask, state.boardMask);
+            });
+        }
+    }
+
+    GameState detectionState = dealtState(11, 3);
+    run("cheat.computeDetectionProbability", [&]() {
+        sink += static_cast<uint64_t>(detectionState.computeDetectionProbability(CheatId::STACK_PEEK, 2, GameStage::TURN) * 1e6);
+    });
+    run("cheat.computeDetectionProbabilities", [&]() {
+        sink += static_cast<uint64_t>(detectionState.computeDetectionProbabilities(2, GameStage::TURN)[1] * 1e6);
+    });
+    GameState advisorState = dealtState(13, 3);
+    advisorState.inHandMask = (1u << advisorState.players.size()) - 1;
+    CheatAdvisor::Settings advisorSettings;
+    advisorSettings.maxSamples = 16;   // One block per option: 128 rollouts
+    advisorSettings.timeBudget = std::chrono::microseconds(0);
+    run("cheat.advise128", [&]() {
+        advisorSettings.seed++;
+        sink += CheatAdvisor::advise(advisorState, 0, 1, advisorSettings).noCheat.samples;
+    });
+    GameState searchState = dealtState(17, 3);
+    searchState.inHandMask = (1u << searchState.players.size()) - 1;
+    searchState.pendingMask = seatBit(2) | seatBit(3);
+    searchState.smallBlindIndex = 0;
+    searchState.pot = 4 * BIG_BLIND;
+    MctsSearch searcher;
+    MctsSearch::Settings searchSettings;
+    searchSettings.maxIterations = 1024;
+    searchSettings.timeBudget = std::chrono::microseconds(0);
+    run("ai.mcts.search1024", [&]() {
+        searcher.reset();
+        searchSettings.seed++;
+        sink += searcher.search(searchState, 1, searchSettings).nodes;
+    });
+    uint32_t cheatIndex = 0;
+    run("cheat.get", [&]() {
+        sink += CheatSystem::get(static_cast<CheatId>(cheatIndex++ % CHEAT_COUNT)).cooldown;
+    });
+    const std::string cheatName = "PeekOpponentHole";
+    run("cheat.parse", [&]() {
+        CheatId id;
+        sink += CheatSystem::parse(cheatName, id) ? static_cast<uint64_t>(id) : 0;
+    });
+
+    HandHistory history;
+    history.openWrite(nullDevice, true);   // Batched, as in --simulate
+    uint32_t recordIndex = 0;
+    run("history.record", [&]() {
+        history.record({RecordType::ACTION, 1, static_cast<uint8_t>(PlayerAction::CALL), 0, recordIndex++, 2, 0});
+    });
+
+    // ===== MACRO =====
+    unsigned int gameSeed = 1;
+    auto game = std::make_unique<BloodGambleGame>(gameSeed, true);
+    run("game.headlessRound", [&]() {
+        if (game->getState().gameOver()) game = std::make_unique<BloodGambleGame>(++gameSeed, true);
+        sink += game->playRound().pot;
+    });
+    TableSetup fullRing;
+    fullRing.seats = MAX_SEATS;
+    auto ringGame = std::make_unique<BloodGambleGame>(gameSeed, true, fullRing);
+    run("game.headlessRoundFullRing", [&]() {
+        if (ringGame->getState().gameOver()) ringGame = std::make_unique<BloodGambleGame>(++gameSeed, true, fullRing);
+        sink += ringGame->playRound().pot;
+    });
+    auto loggedGame = std::make_unique<BloodGambleGame>(gameSeed, true);
+    loggedGame->setHistory(&history);
+    run("game.headlessRoundLogged", [&]() {
+        if (loggedGame->getState().gameOver()) {
+            loggedGame = std::make_unique<BloodGambleGame>(++gameSeed, true);
+            loggedGame->setHistory(&history);
+        }
+        sink += loggedGame->playRound().pot;
+    });
+    run("game.newGame", [&]() {
+        BloodGambleGame fresh(++gameSeed, true);
+        sink += fresh.getState().players.size();
+    });
+
+    if (csv) printCsv(results, std::cout);
+    else printJson(results, std::cout);
+    return EXIT_SUCCESS;
+}
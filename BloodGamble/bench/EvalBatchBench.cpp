@@ -0,0 +1,78 @@
+// Batch hand evaluation benchmark: hands/sec per path for batch sizes 1 .. 1M
+#include "../include/core/HandEvaluator.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+
+namespace {
+
+const size_t MAX_BATCH = 1000000;
+const double MIN_SECONDS = 0.2;
+
+std::vector<CardSet> randomHands(size_t count, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> deck;
+    for (uint8_t index = 0; index < 64; index++) {
+        if (CardSet::fullDeck().contains(index)) deck.push_back(index);
+    }
+
+    std::vector<CardSet> hands(count);
+    for (auto& hand : hands) {
+        for (int i = 0; i < 7; i++) {
+            std::uniform_int_distribution<size_t> pick(i, deck.size() - 1);
+            std::swap(deck[i], deck[pick(rng)]);
+            hand.add(Card::fromIndex(deck[i]));
+        }
+    }
+    return hands;
+}
+
+using BatchFn = void (*)(const CardSet*, uint32_t*, size_t);
+
+double handsPerSecond(BatchFn fn, const std::vector<CardSet>& hands, std::vector<uint32_t>& out, size_t batch) {
+    using Clock = std::chrono::steady_clock;
+    size_t evaluated = 0;
+    size_t offset = 0;
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    do {
+        for (int rep = 0; rep < 64; rep++) {
+            if (offset + batch > hands.size()) offset = 0;
+            fn(hands.data() + offset, out.data() + offset, batch);
+            offset += batch;
+            evaluated += batch;
+        }
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < MIN_SECONDS);
+    return evaluated / elapsed;
+}
+
+} // namespace
+
+int main() {
+    std::vector<CardSet> hands = randomHands(MAX_BATCH, 12345);
+    std::vector<uint32_t> scalar(MAX_BATCH), simd(MAX_BATCH);
+
+    HandEvaluator::evaluateBatchScalar(hands.data(), scalar.data(), hands.size());
+    HandEvaluator::evaluateBatch(hands.data(), simd.data(), hands.size());
+    if (scalar != simd) {
+        std::cerr << "Batch results differ from the scalar evaluator!\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "AVX2 available: " << (HandEvaluator::avx2Supported() ? "yes" : "no") << "\n";
+    std::cout << std::left << std::setw(10) << "batch"
+              << std::right << std::setw(18) << "scalar hands/s"
+              << std::setw(18) << "batch hands/s" << "\n";
+
+    for (size_t batch = 1; batch <= MAX_BATCH; batch *= 10) {
+        double scalarRate = handsPerSecond(HandEvaluator::evaluateBatchScalar, hands, scalar, batch);
+        double batchRate = handsPerSecond(HandEvaluator::evaluateBatch, hands, simd, batch);
+        std::cout << std::left << std::setw(10) << batch << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(18) << scalarRate << std::setw(18) << batchRate << "\n";
+    }
+    return EXIT_SUCCESS;
+}
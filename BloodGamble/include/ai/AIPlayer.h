@@ -3,8 +3,38 @@
 #include "../game/GameState.h"
 #include "../core/Config.h"
 
+// The statistics of the opponents still in the hand as threshold shifts; zero until they
+// play differently from the priors
+struct OpponentRead {
+    double callShift = 0.0;    // Lowers the fold threshold against loose, aggressive or caught-cheating seats
+    double raiseShift = 0.0;   // Lowers the raise threshold against seats that fold to raises or call down
+};
+
+// How estimateStrength may sample. FIXED draws AI_EQUITY_FIXED_SAMPLES on the
+// calling thread, so a seed gives the same decisions on any machine; TIMED is
+// for interactive tables and uses every core within AI_EQUITY_BUDGET_US.
+enum class EquityBudget { FIXED, TIMED };
+
 class AIPlayer {
 public:
     static PlayerAction decideAction(Player& ai, const GameState& game, int callAmount, int minRaise);
+    static PlayerAction decideFromStrength(const Player& ai, double handStrength, int callAmount, int minRaise,
+                                           const OpponentRead& read = OpponentRead());
+    // Lock-free snapshots of Player::stats, safe while another thread plays the hand
+    static OpponentRead readOpponents(const Player& ai, const GameState& game);
     static int decideRaiseAmount(const Player& ai, int callAmount, int minRaise, int maxBet);
+    
+    // Hand strength in [0, 1], 0.5 being an average hand for the number of opponents
+    static double estimateStrength(const Player& ai, const GameState& game,   // Equity engine
+                                   EquityBudget budget = EquityBudget::FIXED);
+    static double quickStrength(const Player& ai, const GameState& game);     // Tables only, no sampling
+    static double quickStrength(CardSet hole, CardSet board, int opponents);
+    // STRATEGY_BUCKETS bucket: one BucketTable read postflop when a table is loaded,
+    // otherwise the quick strength's bucket
+    static int strengthBucket(CardSet hole, CardSet board, int opponents);
+    
+    // Samples the loaded StrategyTable at the strength bucket it was trained on; false when
+    // no table is loaded or training never reached this spot
+    static bool decideFromStrategy(const Player& ai, const GameState& game, int callAmount,
+                                   PlayerAction& action, int& raiseAmount);
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+#include "../core/Card.h"
+#include <cstdint>
+#include <chrono>
+
+struct EquityResult {
+    double equity;          // Average share of the pot won (ties split)
+    double standardError;
+    uint64_t samples;
+};
+
+// Monte Carlo equity: random runouts of the board against random opponent hands.
+// Samples are drawn in fixed-size blocks, block k always uses the RNG stream
+// derived from (seed, k), and early stopping is decided on the contiguous prefix
+// of finished blocks at fixed checkpoints. The result for a given seed is
+// therefore the same for any thread count, unless the time budget cuts it short.
+class EquityEngine {
+public:
+    struct Settings {
+        int threads = 1;
+        uint64_t seed = 0;
+        uint64_t maxSamples = 1 << 18;
+        double targetError = 0.005;                   // Stop once standard error is this tight
+        std::chrono::microseconds timeBudget{0};      // 0 = no deadline
+    };
+
+    static EquityResult estimate(CardSet hole, CardSet board, int opponents,
+                                 const Settings& settings, CardSet dead = CardSet());
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include "../core/Card.h"
+#include <vector>
+#include <cstdint>
+
+// Ties are credited in units of 1/2520 of a pot (2520 divides evenly by 1..10),
+// so split pots stay exact integers when per-thread results are merged.
+const uint64_t POT_SHARE_UNITS = 2520;
+
+struct SeatOutcome {
+    uint64_t wins = 0;
+    uint64_t ties = 0;
+    uint64_t losses = 0;
+    uint64_t shareUnits = 0;    // Pot won, in POT_SHARE_UNITS per deal
+};
+
+struct ExactEquity {
+    std::vector<SeatOutcome> seats;
+    uint64_t deals = 0;
+
+    double equity(int seat) const;
+};
+
+// Exhaustive equity over every board completion and every holding of the seats
+// whose hole cards are unknown. Board cards are added one at a time to the
+// partially built seat hands of the previous level, and the deals are split
+// across threads by the first enumerated card.
+class EquityEnumerator {
+public:
+    // holes[i] is seat i's hole cards, or an empty set when they are unknown
+    static ExactEquity enumerate(const std::vector<CardSet>& holes, CardSet board, int threads,
+                                 CardSet dead = CardSet());
+    // Number of deals enumerate() would visit, for choosing between exact and sampled equity;
+    // UINT64_MAX when the count does not fit
+    static uint64_t dealCount(const std::vector<CardSet>& holes, CardSet board, CardSet dead = CardSet());
+};
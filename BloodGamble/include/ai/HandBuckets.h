@@ -0,0 +1,49 @@
+#pragma once
+#include "HandIndexer.h"
+#include "../core/Card.h"
+#include "../core/MappedFile.h"
+#include <cstdint>
+#include <string>
+
+// ===== POSTFLOP HAND BUCKETS =====
+// Written offline by tools/BucketGen.cpp: every suit-isomorphic (hole, board)
+// class of the flop, turn and river is clustered by its distribution of
+// equity over the remaining runouts, and buckets are numbered by mean equity.
+// One byte per HandIndexer class and street, mapped read-only with --buckets FILE.
+
+const int BUCKET_STREETS = HandIndexer::MAX_BOARD_CARDS - HandIndexer::MIN_BOARD_CARDS + 1;
+
+const char BUCKET_MAGIC[4] = {'B', 'G', 'B', 'K'};
+const uint16_t BUCKET_VERSION = 1;
+
+struct BucketFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint8_t streets, buckets;
+    uint32_t classes[BUCKET_STREETS];   // HandIndexer::size of the flop, turn and river
+    uint16_t runouts, opponents;        // Samples per class, for reference
+    uint32_t id;                        // Hash of the buckets; strategies trained on them record it
+    uint32_t reserved;
+};
+static_assert(sizeof(BucketFileHeader) == 32, "Bucket header must stay 32 bytes");
+
+// Read-only view of a bucket file, mapped once at startup
+class BucketTable {
+private:
+    MappedFile file;
+    const uint8_t* streets[BUCKET_STREETS] = {};
+    uint32_t tableId = 0;
+
+public:
+    // False (and nothing loaded) unless the file holds STRATEGY_BUCKETS buckets for every class
+    bool load(const std::string& path, std::string& error);
+    bool loaded() const { return streets[0] != nullptr; }
+    uint32_t id() const { return tableId; }   // 0 when nothing is loaded
+
+    // Bucket of a flop, turn or river hand: one index and one table read
+    int bucket(CardSet hole, CardSet board) const {
+        return streets[board.size() - HandIndexer::MIN_BOARD_CARDS][HandIndexer::index(hole, board)];
+    }
+
+    static BucketTable& global();   // The table AIPlayer reads; empty unless main loads one
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include "../core/Card.h"
+#include <cstdint>
+
+// ===== SUIT-ISOMORPHIC HAND INDEX =====
+// Numbers the (hole, board) pairs of one postflop street up to a relabelling
+// of the suits: hands that differ only by a suit permutation share an index,
+// and every index in [0, size) is one class. That is 1,286,792 flop,
+// 13,960,050 turn and 123,156,254 river classes instead of 26, 305 and 2,809
+// million deals.
+//
+// Each suit becomes one number from its hole and board rank masks; suits are
+// sorted by (hole cards, board cards, number), and each run of suits with the
+// same card counts is ranked as a multiset.
+class HandIndexer {
+public:
+    static const int MIN_BOARD_CARDS = 3;
+    static const int MAX_BOARD_CARDS = 5;
+
+    static uint32_t size(int boardCards);
+    static uint32_t index(CardSet hole, CardSet board);
+    // One hand of the class (the suits in canonical order)
+    static void unindex(int boardCards, uint32_t index, CardSet& hole, CardSet& board);
+    // Deals the class of this hand stands for, 1 to 24
+    static int weight(CardSet hole, CardSet board);
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include "../core/Card.h"
+#include "../core/Config.h"
+#include "../core/Player.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+class GameState;
+
+// ===== INFORMATION-SET MONTE CARLO TREE SEARCH =====
+// Single-observer IS-MCTS for one AI seat. Every iteration determinizes the
+// hand: opponents' hole cards and the rest of the board are dealt at random
+// from the cards the seat cannot see. The tree is over public action
+// histories, which mean the same thing in every determinization because the
+// betting never depends on the cards. At the searching seat's nodes UCB1
+// picks among fold, call, raise by MIN_BET or MAX_BET and all-in; opponents
+// play AIPlayer's quick rule on their sampled cards, each distinct answer
+// becoming a child. Below the tree every seat plays the quick rule.
+//
+// Nodes come from a pool allocated once per search object. The next search
+// in the same hand re-roots at the node whose public state matches the table
+// (found below the action chosen last time) and copies that subtree to the
+// front of the other half of the pool, so its statistics carry over. Rewards
+// are absolute HP rather than changes from the root, so carried-over sums
+// stay comparable with new ones.
+
+// Public betting state of a hand, stepped exactly as BloodGambleGame::bettingRound does
+struct MctsState {
+    int seats = 0;
+    int street = 0;        // GameStage value
+    int toAct = -1;        // -1 once the hand is decided
+    int pot = 0;
+    int highBet = 0;
+    int raises = 0;        // Raises this street, for MCTS_MAX_RAISES
+    int smallBlind = 0;
+    uint32_t inHand = 0;
+    uint32_t allIn = 0;
+    uint32_t pending = 0;  // Still to act this pass, toAct excluded
+    int stack[MAX_SEATS] = {};
+    int bet[MAX_SEATS] = {};
+
+    static MctsState fromGame(const GameState& game, int seat);
+    void apply(PlayerAction action, int raiseAmount);
+    bool over() const { return toAct < 0; }
+    // Same position at the table; the raise count only limits the tree
+    bool samePosition(const MctsState& other) const;
+
+private:
+    void advance(int from);
+};
+
+struct MctsNode {
+    int32_t firstChild = -1;
+    int32_t nextSibling = -1;
+    uint32_t visits = 0;
+    uint8_t seat = 0;            // Seat whose action led here
+    uint8_t action = 0;          // PlayerAction
+    int16_t raiseAmount = 0;
+    double reward = 0.0;         // Sum of `seat`'s end-of-hand HP
+};
+
+class MctsSearch {
+public:
+    struct Settings {
+        std::chrono::microseconds timeBudget{MCTS_BUDGET_US};   // 0 = no deadline
+        uint64_t maxIterations = 0;                             // 0 = until the deadline
+        uint64_t seed = 0;
+        double exploration = MCTS_EXPLORATION;
+    };
+
+    struct Result {
+        PlayerAction action = PlayerAction::CALL;
+        int raiseAmount = 0;         // HP on top of the call, for RAISE
+        uint64_t iterations = 0;
+        uint32_t reusedVisits = 0;   // Root visits carried over from the previous search
+        size_t nodes = 0;            // Pool nodes in use afterwards
+    };
+
+    explicit MctsSearch(size_t poolNodes = MCTS_POOL_NODES);
+
+    // Best action for `seat` on its turn; needs game.pendingMask of the betting pass in progress
+    Result search(const GameState& game, int seat, const Settings& settings);
+    void reset();   // Forget the tree
+
+private:
+    std::vector<MctsNode> pool;
+    std::vector<MctsNode> spare;   // Other half: target of re-rooting
+    size_t used = 0;
+    std::vector<Player> models;    // Quick-rule personalities, one per seat, built once
+
+    // Where the last search ended, for re-rooting
+    MctsState rootState;
+    int32_t chosen = -1;
+    int searcher = -1;
+    int roundNumber = -1;
+    uint64_t gameSeed = 0;
+
+    int32_t newNode(int32_t parent, int seat, PlayerAction action, int raiseAmount);
+    int32_t findChild(int32_t parent, PlayerAction action, int raiseAmount) const;
+    int32_t findPosition(int32_t node, const MctsState& state, const MctsState& target, int depth,
+                         MctsState& match) const;
+    int32_t reroot(int32_t node);
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+// Generated by tools/PreflopTableGen.cpp (1000000 samples per entry). Do not edit.
+// Equity of each starting hand against 1 to 9 random opponents, see PreflopTable.h
+constexpr float PREFLOP_EQUITY[PREFLOP_HAND_CLASSES][PREFLOP_MAX_OPPONENTS] = {
+    {0.5037f, 0.3065f, 0.2194f, 0.1771f, 0.1545f, 0.1416f, 0.1313f, 0.1252f, 0.1195f}, // 22
+    {0.3229f, 0.1974f, 0.1398f, 0.1077f, 0.0894f, 0.0772f, 0.0685f, 0.0614f, 0.0558f}, // 32o
+    {0.3318f, 0.2064f, 0.1475f, 0.1156f, 0.0959f, 0.0824f, 0.0731f, 0.0657f, 0.0601f}, // 42o
+    {0.3425f, 0.2150f, 0.1547f, 0.1208f, 0.1000f, 0.0863f, 0.0765f, 0.0686f, 0.0622f}, // 52o
+    {0.3405f, 0.2075f, 0.1462f, 0.1119f, 0.0918f, 0.0772f, 0.0669f, 0.0601f, 0.0537f}, // 62o
+    {0.3467f, 0.2050f, 0.1422f, 0.1076f, 0.0860f, 0.0718f, 0.0619f, 0.0540f, 0.0477f}, // 72o
+    {0.3676f, 0.2176f, 0.1518f, 0.1148f, 0.0908f, 0.0758f, 0.0642f, 0.0562f, 0.0491f}, // 82o
+    {0.3913f, 0.2305f, 0.1606f, 0.1215f, 0.0971f, 0.0802f, 0.0682f, 0.0597f, 0.0521f}, // 92o
+    {0.4163f, 0.2472f, 0.1737f, 0.1320f, 0.1061f, 0.0882f, 0.0756f, 0.0654f, 0.0577f}, // T2o
+    {0.4432f, 0.2656f, 0.1863f, 0.1418f, 0.1140f, 0.0956f, 0.0813f, 0.0706f, 0.0623f}, // J2o
+    {0.4727f, 0.2868f, 0.2006f, 0.1539f, 0.1244f, 0.1040f, 0.0887f, 0.0773f, 0.0683f}, // Q2o
+    {0.5053f, 0.3111f, 0.2206f, 0.1702f, 0.1382f, 0.1163f, 0.0993f, 0.0864f, 0.0765f}, // K2o
+    {0.5503f, 0.3527f, 0.2540f, 0.1991f, 0.1629f, 0.1371f, 0.1194f, 0.1039f, 0.0919f}, // A2o
+    {0.3609f, 0.2388f, 0.1820f, 0.1501f, 0.1313f, 0.1171f, 0.1066f, 0.0991f, 0.0916f}, // 32s
+    {0.5371f, 0.3354f, 0.2398f, 0.1897f, 0.1628f, 0.1456f, 0.1344f, 0.1268f, 0.1201f}, // 33
+    {0.3522f, 0.2261f, 0.1633f, 0.1297f, 0.1079f, 0.0932f, 0.0826f, 0.0753f, 0.0687f}, // 43o
+    {0.3623f, 0.2344f, 0.1724f, 0.1361f, 0.1142f, 0.0989f, 0.0885f, 0.0797f, 0.0734f}, // 53o
+    {0.3611f, 0.2275f, 0.1643f, 0.1290f, 0.1056f, 0.0905f, 0.0797f, 0.0710f, 0.0648f}, // 63o
+    {0.3665f, 0.2246f, 0.1593f, 0.1232f, 0.0990f, 0.0832f, 0.0726f, 0.0637f, 0.0574f}, // 73o
+    {0.3758f, 0.2236f, 0.1570f, 0.1181f, 0.0950f, 0.0786f, 0.0666f, 0.0585f, 0.0517f}, // 83o
+    {0.4003f, 0.2395f, 0.1680f, 0.1267f, 0.1017f, 0.0836f, 0.0709f, 0.0615f, 0.0539f}, // 93o
+    {0.4258f, 0.2553f, 0.1805f, 0.1382f, 0.1101f, 0.0912f, 0.0775f, 0.0681f, 0.0595f}, // T3o
+    {0.4529f, 0.2732f, 0.1924f, 0.1473f, 0.1182f, 0.0981f, 0.0838f, 0.0723f, 0.0637f}, // J3o
+    {0.4820f, 0.2944f, 0.2079f, 0.1596f, 0.1285f, 0.1071f, 0.0914f, 0.0798f, 0.0694f}, // Q3o
+    {0.5146f, 0.3210f, 0.2281f, 0.1764f, 0.1433f, 0.1196f, 0.1023f, 0.0892f, 0.0781f}, // K3o
+    {0.5594f, 0.3622f, 0.2629f, 0.2061f, 0.1696f, 0.1431f, 0.1239f, 0.1084f, 0.0960f}, // A3o
+    {0.3687f, 0.2462f, 0.1887f, 0.1571f, 0.1363f, 0.1224f, 0.1112f, 0.1024f, 0.0958f}, // 42s
+    {0.3864f, 0.2646f, 0.2040f, 0.1693f, 0.1474f, 0.1326f, 0.1197f, 0.1115f, 0.1035f}, // 43s
+    {0.5700f, 0.3671f, 0.2620f, 0.2063f, 0.1718f, 0.1524f, 0.1383f, 0.1292f, 0.1217f}, // 44
+    {0.3819f, 0.2532f, 0.1882f, 0.1508f, 0.1264f, 0.1100f, 0.0982f, 0.0897f, 0.0819f}, // 54o
+    {0.3806f, 0.2473f, 0.1822f, 0.1441f, 0.1202f, 0.1026f, 0.0919f, 0.0827f, 0.0755f}, // 64o
+    {0.3855f, 0.2451f, 0.1783f, 0.1387f, 0.1137f, 0.0966f, 0.0845f, 0.0754f, 0.0681f}, // 74o
+    {0.3946f, 0.2438f, 0.1751f, 0.1342f, 0.1080f, 0.0897f, 0.0779f, 0.0685f, 0.0610f}, // 84o
+    {0.4076f, 0.2450f, 0.1730f, 0.1311f, 0.1047f, 0.0865f, 0.0732f, 0.0638f, 0.0558f}, // 94o
+    {0.4349f, 0.2642f, 0.1868f, 0.1430f, 0.1150f, 0.0952f, 0.0802f, 0.0697f, 0.0612f}, // T4o
+    {0.4617f, 0.2817f, 0.1998f, 0.1531f, 0.1226f, 0.1016f, 0.0860f, 0.0747f, 0.0653f}, // J4o
+    {0.4918f, 0.3039f, 0.2159f, 0.1653f, 0.1334f, 0.1107f, 0.0941f, 0.0817f, 0.0717f}, // Q4o
+    {0.5227f, 0.3295f, 0.2360f, 0.1819f, 0.1477f, 0.1232f, 0.1059f, 0.0908f, 0.0805f}, // K4o
+    {0.5666f, 0.3709f, 0.2714f, 0.2123f, 0.1741f, 0.1478f, 0.1272f, 0.1117f, 0.0981f}, // A4o
+    {0.3795f, 0.2543f, 0.1954f, 0.1614f, 0.1407f, 0.1262f, 0.1145f, 0.1060f, 0.0989f}, // 52s
+    {0.3975f, 0.2739f, 0.2116f, 0.1760f, 0.1528f, 0.1373f, 0.1257f, 0.1161f, 0.1084f}, // 53s
+    {0.4133f, 0.2908f, 0.2265f, 0.1895f, 0.1644f, 0.1471f, 0.1349f, 0.1255f, 0.1165f}, // 54s
+    {0.6033f, 0.4015f, 0.2888f, 0.2242f, 0.1851f, 0.1605f, 0.1439f, 0.1330f, 0.1240f}, // 55
+    {0.3996f, 0.2664f, 0.1994f, 0.1589f, 0.1328f, 0.1146f, 0.1021f, 0.0914f, 0.0846f}, // 65o
+    {0.4051f, 0.2646f, 0.1966f, 0.1554f, 0.1283f, 0.1100f, 0.0971f, 0.0875f, 0.0793f}, // 75o
+    {0.4140f, 0.2644f, 0.1933f, 0.1518f, 0.1232f, 0.1043f, 0.0904f, 0.0804f, 0.0724f}, // 85o
+    {0.4271f, 0.2654f, 0.1917f, 0.1474f, 0.1191f, 0.0994f, 0.0849f, 0.0739f, 0.0659f}, // 95o
+    {0.4421f, 0.2704f, 0.1928f, 0.1482f, 0.1189f, 0.0984f, 0.0835f, 0.0726f, 0.0635f}, // T5o
+    {0.4725f, 0.2914f, 0.2074f, 0.1592f, 0.1283f, 0.1059f, 0.0899f, 0.0773f, 0.0676f}, // J5o
+    {0.5008f, 0.3122f, 0.2232f, 0.1725f, 0.1388f, 0.1148f, 0.0974f, 0.0842f, 0.0738f}, // Q5o
+    {0.5333f, 0.3391f, 0.2433f, 0.1894f, 0.1527f, 0.1274f, 0.1084f, 0.0947f, 0.0829f}, // K5o
+    {0.5769f, 0.3815f, 0.2803f, 0.2200f, 0.1800f, 0.1525f, 0.1310f, 0.1148f, 0.1012f}, // A5o
+    {0.3770f, 0.2487f, 0.1877f, 0.1538f, 0.1319f, 0.1183f, 0.1062f, 0.0980f, 0.0905f}, // 62s
+    {0.3954f, 0.2663f, 0.2054f, 0.1684f, 0.1459f, 0.1296f, 0.1178f, 0.1088f, 0.1000f}, // 63s
+    {0.4131f, 0.2851f, 0.2211f, 0.1837f, 0.1589f, 0.1418f, 0.1283f, 0.1188f, 0.1108f}, // 64s
+    {0.4313f, 0.3033f, 0.2364f, 0.1975f, 0.1705f, 0.1523f, 0.1382f, 0.1273f, 0.1190f}, // 65s
+    {0.6323f, 0.4321f, 0.3153f, 0.2447f, 0.2003f, 0.1725f, 0.1531f, 0.1401f, 0.1296f}, // 66
+    {0.4234f, 0.2843f, 0.2148f, 0.1699f, 0.1416f, 0.1216f, 0.1065f, 0.0962f, 0.0872f}, // 76o
+    {0.4318f, 0.2834f, 0.2112f, 0.1681f, 0.1377f, 0.1177f, 0.1027f, 0.0919f, 0.0832f}, // 86o
+    {0.4457f, 0.2859f, 0.2109f, 0.1651f, 0.1349f, 0.1132f, 0.0976f, 0.0859f, 0.0774f}, // 96o
+    {0.4612f, 0.2916f, 0.2121f, 0.1652f, 0.1330f, 0.1122f, 0.0951f, 0.0829f, 0.0737f}, // T6o
+    {0.4788f, 0.2983f, 0.2143f, 0.1644f, 0.1325f, 0.1091f, 0.0930f, 0.0801f, 0.0702f}, // J6o
+    {0.5097f, 0.3224f, 0.2318f, 0.1794f, 0.1447f, 0.1196f, 0.1014f, 0.0872f, 0.0766f}, // Q6o
+    {0.5425f, 0.3482f, 0.2521f, 0.1958f, 0.1582f, 0.1324f, 0.1130f, 0.0969f, 0.0852f}, // K6o
+    {0.5767f, 0.3792f, 0.2757f, 0.2131f, 0.1745f, 0.1460f, 0.1245f, 0.1085f, 0.0961f}, // A6o
+    {0.3824f, 0.2455f, 0.1849f, 0.1503f, 0.1280f, 0.1123f, 0.1020f, 0.0925f, 0.0847f}, // 72s
+    {0.4009f, 0.2643f, 0.2005f, 0.1639f, 0.1405f, 0.1237f, 0.1112f, 0.1014f, 0.0939f}, // 73s
+    {0.4186f, 0.2835f, 0.2181f, 0.1794f, 0.1533f, 0.1354f, 0.1231f, 0.1124f, 0.1043f}, // 74s
+    {0.4375f, 0.3011f, 0.2347f, 0.1940f, 0.1668f, 0.1488f, 0.1342f, 0.1238f, 0.1146f}, // 75s
+    {0.4536f, 0.3191f, 0.2506f, 0.2077f, 0.1793f, 0.1589f, 0.1432f, 0.1317f, 0.1224f}, // 76s
+    {0.6623f, 0.4643f, 0.3431f, 0.2681f, 0.2183f, 0.1858f, 0.1639f, 0.1476f, 0.1364f}, // 77
+    {0.4499f, 0.3042f, 0.2301f, 0.1835f, 0.1525f, 0.1305f, 0.1142f, 0.1017f, 0.0920f}, // 87o
+    {0.4630f, 0.3069f, 0.2301f, 0.1830f, 0.1510f, 0.1277f, 0.1108f, 0.0983f, 0.0889f}, // 97o
+    {0.4782f, 0.3120f, 0.2324f, 0.1834f, 0.1508f, 0.1276f, 0.1098f, 0.0960f, 0.0861f}, // T7o
+    {0.4960f, 0.3180f, 0.2336f, 0.1829f, 0.1489f, 0.1246f, 0.1064f, 0.0922f, 0.0809f}, // J7o
+    {0.5173f, 0.3310f, 0.2396f, 0.1868f, 0.1503f, 0.1249f, 0.1063f, 0.0916f, 0.0800f}, // Q7o
+    {0.5516f, 0.3608f, 0.2628f, 0.2050f, 0.1663f, 0.1387f, 0.1182f, 0.1021f, 0.0892f}, // K7o
+    {0.5887f, 0.3925f, 0.2879f, 0.2245f, 0.1824f, 0.1537f, 0.1310f, 0.1136f, 0.0994f}, // A7o
+    {0.4032f, 0.2582f, 0.1937f, 0.1566f, 0.1333f, 0.1168f, 0.1044f, 0.0951f, 0.0877f}, // 82s
+    {0.4091f, 0.2636f, 0.1982f, 0.1608f, 0.1367f, 0.1197f, 0.1070f, 0.0976f, 0.0890f}, // 83s
+    {0.4272f, 0.2822f, 0.2152f, 0.1749f, 0.1484f, 0.1304f, 0.1173f, 0.1069f, 0.0980f}, // 84s
+    {0.4451f, 0.3011f, 0.2321f, 0.1897f, 0.1633f, 0.1422f, 0.1287f, 0.1174f, 0.1093f}, // 85s
+    {0.4622f, 0.3201f, 0.2494f, 0.2058f, 0.1758f, 0.1555f, 0.1406f, 0.1284f, 0.1187f}, // 86s
+    {0.4790f, 0.3384f, 0.2662f, 0.2207f, 0.1888f, 0.1671f, 0.1510f, 0.1374f, 0.1273f}, // 87s
+    {0.6913f, 0.4998f, 0.3766f, 0.2962f, 0.2400f, 0.2030f, 0.1771f, 0.1584f, 0.1449f}, // 88
+    {0.4817f, 0.3276f, 0.2495f, 0.2005f, 0.1678f, 0.1416f, 0.1230f, 0.1096f, 0.0987f}, // 98o
+    {0.4975f, 0.3340f, 0.2532f, 0.2043f, 0.1697f, 0.1437f, 0.1251f, 0.1104f, 0.0991f}, // T8o
+    {0.5151f, 0.3416f, 0.2552f, 0.2030f, 0.1678f, 0.1408f, 0.1215f, 0.1063f, 0.0946f}, // J8o
+    {0.5360f, 0.3524f, 0.2609f, 0.2058f, 0.1682f, 0.1413f, 0.1214f, 0.1052f, 0.0924f}, // Q8o
+    {0.5607f, 0.3696f, 0.2715f, 0.2134f, 0.1734f, 0.1457f, 0.1243f, 0.1073f, 0.0939f}, // K8o
+    {0.5986f, 0.4048f, 0.2995f, 0.2357f, 0.1921f, 0.1609f, 0.1377f, 0.1197f, 0.1049f}, // A8o
+    {0.4239f, 0.2704f, 0.2022f, 0.1646f, 0.1397f, 0.1220f, 0.1090f, 0.0990f, 0.0909f}, // 92s
+    {0.4328f, 0.2784f, 0.2085f, 0.1690f, 0.1431f, 0.1248f, 0.1111f, 0.1016f, 0.0922f}, // 93s
+    {0.4385f, 0.2837f, 0.2140f, 0.1733f, 0.1455f, 0.1276f, 0.1136f, 0.1032f, 0.0944f}, // 94s
+    {0.4569f, 0.3025f, 0.2307f, 0.1876f, 0.1589f, 0.1389f, 0.1237f, 0.1130f, 0.1034f}, // 95s
+    {0.4739f, 0.3219f, 0.2480f, 0.2036f, 0.1737f, 0.1516f, 0.1362f, 0.1236f, 0.1142f}, // 96s
+    {0.4916f, 0.3413f, 0.2667f, 0.2208f, 0.1881f, 0.1650f, 0.1476f, 0.1359f, 0.1250f}, // 97s
+    {0.5088f, 0.3599f, 0.2844f, 0.2364f, 0.2031f, 0.1783f, 0.1599f, 0.1452f, 0.1334f}, // 98s
+    {0.7208f, 0.5361f, 0.4115f, 0.3256f, 0.2664f, 0.2243f, 0.1935f, 0.1719f, 0.1552f}, // 99
+    {0.5158f, 0.3564f, 0.2766f, 0.2252f, 0.1891f, 0.1623f, 0.1408f, 0.1258f, 0.1137f}, // T9o
+    {0.5325f, 0.3634f, 0.2782f, 0.2249f, 0.1872f, 0.1593f, 0.1386f, 0.1222f, 0.1094f}, // J9o
+    {0.5535f, 0.3758f, 0.2839f, 0.2278f, 0.1893f, 0.1603f, 0.1380f, 0.1209f, 0.1074f}, // Q9o
+    {0.5778f, 0.3927f, 0.2948f, 0.2353f, 0.1936f, 0.1646f, 0.1414f, 0.1232f, 0.1080f}, // K9o
+    {0.6077f, 0.4157f, 0.3101f, 0.2460f, 0.2016f, 0.1702f, 0.1465f, 0.1272f, 0.1118f}, // A9o
+    {0.4487f, 0.2875f, 0.2151f, 0.1749f, 0.1491f, 0.1308f, 0.1160f, 0.1058f, 0.0976f}, // T2s
+    {0.4570f, 0.2938f, 0.2209f, 0.1794f, 0.1522f, 0.1334f, 0.1187f, 0.1075f, 0.0988f}, // T3s
+    {0.4654f, 0.3015f, 0.2268f, 0.1838f, 0.1557f, 0.1361f, 0.1213f, 0.1094f, 0.1004f}, // T4s
+    {0.4733f, 0.3076f, 0.2317f, 0.1882f, 0.1599f, 0.1394f, 0.1236f, 0.1125f, 0.1028f}, // T5s
+    {0.4886f, 0.3258f, 0.2504f, 0.2042f, 0.1728f, 0.1510f, 0.1351f, 0.1217f, 0.1114f}, // T6s
+    {0.5073f, 0.3466f, 0.2692f, 0.2216f, 0.1889f, 0.1647f, 0.1474f, 0.1335f, 0.1238f}, // T7s
+    {0.5229f, 0.3674f, 0.2883f, 0.2401f, 0.2064f, 0.1812f, 0.1615f, 0.1471f, 0.1355f}, // T8s
+    {0.5407f, 0.3870f, 0.3088f, 0.2589f, 0.2247f, 0.1977f, 0.1770f, 0.1609f, 0.1488f}, // T9s
+    {0.7507f, 0.5766f, 0.4520f, 0.3627f, 0.2996f, 0.2508f, 0.2178f, 0.1912f, 0.1717f}, // TT
+    {0.5526f, 0.3903f, 0.3072f, 0.2536f, 0.2146f, 0.1858f, 0.1630f, 0.1446f, 0.1303f}, // JTo
+    {0.5732f, 0.4018f, 0.3126f, 0.2564f, 0.2172f, 0.1866f, 0.1632f, 0.1439f, 0.1291f}, // QTo
+    {0.5974f, 0.4190f, 0.3242f, 0.2641f, 0.2216f, 0.1913f, 0.1673f, 0.1467f, 0.1310f}, // KTo
+    {0.6278f, 0.4430f, 0.3395f, 0.2745f, 0.2305f, 0.1974f, 0.1711f, 0.1505f, 0.1332f}, // ATo
+    {0.4732f, 0.3030f, 0.2272f, 0.1842f, 0.1572f, 0.1376f, 0.1232f, 0.1121f, 0.1032f}, // J2s
+    {0.4835f, 0.3109f, 0.2326f, 0.1894f, 0.1605f, 0.1405f, 0.1258f, 0.1138f, 0.1043f}, // J3s
+    {0.4905f, 0.3195f, 0.2399f, 0.1939f, 0.1652f, 0.1434f, 0.1280f, 0.1158f, 0.1064f}, // J4s
+    {0.4999f, 0.3265f, 0.2468f, 0.1995f, 0.1688f, 0.1471f, 0.1308f, 0.1185f, 0.1076f}, // J5s
+    {0.5065f, 0.3336f, 0.2520f, 0.2047f, 0.1732f, 0.1508f, 0.1339f, 0.1207f, 0.1105f}, // J6s
+    {0.5240f, 0.3537f, 0.2716f, 0.2217f, 0.1877f, 0.1643f, 0.1460f, 0.1310f, 0.1194f}, // J7s
+    {0.5405f, 0.3748f, 0.2911f, 0.2402f, 0.2048f, 0.1797f, 0.1593f, 0.1449f, 0.1322f}, // J8s
+    {0.5563f, 0.3950f, 0.3124f, 0.2604f, 0.2233f, 0.1965f, 0.1752f, 0.1588f, 0.1455f}, // J9s
+    {0.5751f, 0.4190f, 0.3385f, 0.2862f, 0.2490f, 0.2203f, 0.1974f, 0.1796f, 0.1656f}, // JTs
+    {0.7745f, 0.6124f, 0.4911f, 0.4023f, 0.3354f, 0.2846f, 0.2459f, 0.2163f, 0.1931f}, // JJ
+    {0.5813f, 0.4132f, 0.3253f, 0.2695f, 0.2294f, 0.1977f, 0.1735f, 0.1530f, 0.1373f}, // QJo
+    {0.6065f, 0.4318f, 0.3368f, 0.2766f, 0.2354f, 0.2033f, 0.1776f, 0.1567f, 0.1396f}, // KJo
+    {0.6349f, 0.4554f, 0.3539f, 0.2889f, 0.2428f, 0.2097f, 0.1831f, 0.1610f, 0.1426f}, // AJo
+    {0.5008f, 0.3233f, 0.2425f, 0.1970f, 0.1678f, 0.1477f, 0.1315f, 0.1202f, 0.1097f}, // Q2s
+    {0.5108f, 0.3320f, 0.2495f, 0.2019f, 0.1719f, 0.1500f, 0.1335f, 0.1214f, 0.1111f}, // Q3s
+    {0.5182f, 0.3400f, 0.2550f, 0.2076f, 0.1755f, 0.1536f, 0.1371f, 0.1236f, 0.1130f}, // Q4s
+    {0.5279f, 0.3485f, 0.2624f, 0.2133f, 0.1800f, 0.1569f, 0.1393f, 0.1261f, 0.1151f}, // Q5s
+    {0.5364f, 0.3568f, 0.2707f, 0.2185f, 0.1852f, 0.1608f, 0.1430f, 0.1282f, 0.1175f}, // Q6s
+    {0.5432f, 0.3648f, 0.2769f, 0.2251f, 0.1905f, 0.1659f, 0.1471f, 0.1327f, 0.1212f}, // Q7s
+    {0.5596f, 0.3853f, 0.2978f, 0.2438f, 0.2069f, 0.1807f, 0.1607f, 0.1453f, 0.1320f}, // Q8s
+    {0.5768f, 0.4059f, 0.3184f, 0.2635f, 0.2261f, 0.1982f, 0.1762f, 0.1593f, 0.1459f}, // Q9s
+    {0.5940f, 0.4326f, 0.3445f, 0.2907f, 0.2514f, 0.2214f, 0.1992f, 0.1810f, 0.1648f}, // QTs
+    {0.6026f, 0.4412f, 0.3563f, 0.3018f, 0.2618f, 0.2310f, 0.2078f, 0.1883f, 0.1723f}, // QJs
+    {0.7988f, 0.6492f, 0.5356f, 0.4477f, 0.3782f, 0.3259f, 0.2842f, 0.2491f, 0.2228f}, // QQ
+    {0.6147f, 0.4450f, 0.3524f, 0.2930f, 0.2502f, 0.2178f, 0.1909f, 0.1697f, 0.1510f}, // KQo
+    {0.6453f, 0.4674f, 0.3682f, 0.3053f, 0.2602f, 0.2243f, 0.1967f, 0.1746f, 0.1560f}, // AQo
+    {0.5321f, 0.3484f, 0.2615f, 0.2129f, 0.1816f, 0.1599f, 0.1433f, 0.1299f, 0.1198f}, // K2s
+    {0.5404f, 0.3564f, 0.2692f, 0.2184f, 0.1861f, 0.1631f, 0.1454f, 0.1323f, 0.1213f}, // K3s
+    {0.5489f, 0.3652f, 0.2755f, 0.2243f, 0.1905f, 0.1656f, 0.1487f, 0.1344f, 0.1231f}, // K4s
+    {0.5577f, 0.3738f, 0.2829f, 0.2295f, 0.1946f, 0.1707f, 0.1518f, 0.1378f, 0.1252f}, // K5s
+    {0.5662f, 0.3821f, 0.2898f, 0.2359f, 0.2007f, 0.1747f, 0.1556f, 0.1402f, 0.1280f}, // K6s
+    {0.5754f, 0.3935f, 0.2995f, 0.2437f, 0.2071f, 0.1800f, 0.1601f, 0.1438f, 0.1315f}, // K7s
+    {0.5836f, 0.4017f, 0.3085f, 0.2510f, 0.2133f, 0.1866f, 0.1658f, 0.1482f, 0.1354f}, // K8s
+    {0.5992f, 0.4229f, 0.3298f, 0.2713f, 0.2323f, 0.2036f, 0.1803f, 0.1632f, 0.1489f}, // K9s
+    {0.6183f, 0.4479f, 0.3563f, 0.2985f, 0.2581f, 0.2274f, 0.2044f, 0.1855f, 0.1686f}, // KTs
+    {0.6262f, 0.4586f, 0.3680f, 0.3101f, 0.2697f, 0.2384f, 0.2132f, 0.1932f, 0.1761f}, // KJs
+    {0.6342f, 0.4715f, 0.3822f, 0.3251f, 0.2836f, 0.2518f, 0.2260f, 0.2043f, 0.1864f}, // KQs
+    {0.8241f, 0.6881f, 0.5830f, 0.4980f, 0.4297f, 0.3746f, 0.3297f, 0.2917f, 0.2602f}, // KK
+    {0.6535f, 0.4823f, 0.3852f, 0.3232f, 0.2787f, 0.2435f, 0.2154f, 0.1924f, 0.1720f}, // AKo
+    {0.5741f, 0.3875f, 0.2940f, 0.2405f, 0.2062f, 0.1815f, 0.1621f, 0.1478f, 0.1359f}, // A2s
+    {0.5822f, 0.3962f, 0.3024f, 0.2468f, 0.2118f, 0.1862f, 0.1675f, 0.1524f, 0.1402f}, // A3s
+    {0.5903f, 0.4052f, 0.3101f, 0.2534f, 0.2168f, 0.1907f, 0.1708f, 0.1550f, 0.1423f}, // A4s
+    {0.5992f, 0.4139f, 0.3178f, 0.2603f, 0.2220f, 0.1949f, 0.1740f, 0.1575f, 0.1443f}, // A5s
+    {0.5996f, 0.4110f, 0.3125f, 0.2544f, 0.2160f, 0.1890f, 0.1678f, 0.1517f, 0.1395f}, // A6s
+    {0.6098f, 0.4241f, 0.3241f, 0.2638f, 0.2238f, 0.1943f, 0.1735f, 0.1560f, 0.1430f}, // A7s
+    {0.6189f, 0.4351f, 0.3346f, 0.2736f, 0.2317f, 0.2031f, 0.1801f, 0.1611f, 0.1471f}, // A8s
+    {0.6283f, 0.4451f, 0.3451f, 0.2829f, 0.2410f, 0.2103f, 0.1873f, 0.1687f, 0.1532f}, // A9s
+    {0.6454f, 0.4695f, 0.3718f, 0.3105f, 0.2671f, 0.2353f, 0.2094f, 0.1896f, 0.1736f}, // ATs
+    {0.6536f, 0.4821f, 0.3851f, 0.3227f, 0.2790f, 0.2460f, 0.2198f, 0.1994f, 0.1819f}, // AJs
+    {0.6624f, 0.4945f, 0.3980f, 0.3377f, 0.2936f, 0.2587f, 0.2324f, 0.2108f, 0.1928f}, // AQs
+    {0.6706f, 0.5068f, 0.4136f, 0.3542f, 0.3104f, 0.2772f, 0.2491f, 0.2264f, 0.2073f}, // AKs
+    {0.8517f, 0.7345f, 0.6383f, 0.5598f, 0.4920f, 0.4348f, 0.3877f, 0.3455f, 0.3110f}, // AA
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include "../core/Card.h"
+#include "../core/Config.h"
+#include <algorithm>
+
+// ===== PREFLOP EQUITY TABLE =====
+// 169 suit-isomorphic starting hands on a 13x13 grid: pairs on the diagonal,
+// suited hands at [high][low], offsuit hands at [low][high].
+const int PREFLOP_HAND_CLASSES = 169;
+const int PREFLOP_MAX_OPPONENTS = MAX_SEATS - 1;   // Every table size has its own column
+
+// Generated offline by tools/PreflopTableGen.cpp
+#include "PreflopEquityTable.h"
+
+constexpr int preflopHandIndex(int highRank, int lowRank, bool suited) {
+    // Ranks are 0 (TWO) .. 12 (ACE), highRank >= lowRank
+    return suited ? highRank * 13 + lowRank : lowRank * 13 + highRank;
+}
+
+inline int preflopHandIndex(const Card& a, const Card& b) {
+    int rankA = static_cast<int>(a.rank) - 2;
+    int rankB = static_cast<int>(b.rank) - 2;
+    return preflopHandIndex(std::max(rankA, rankB), std::min(rankA, rankB), a.suit == b.suit && rankA != rankB);
+}
+
+// Equity against 1..PREFLOP_MAX_OPPONENTS random opponents
+inline double preflopEquity(const Card& a, const Card& b, int opponents) {
+    return PREFLOP_EQUITY[preflopHandIndex(a, b)][std::clamp(opponents, 1, PREFLOP_MAX_OPPONENTS) - 1];
+}
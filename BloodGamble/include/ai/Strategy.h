@@ -0,0 +1,75 @@
+#pragma once
+#include "../core/Config.h"
+#include "../core/MappedFile.h"
+#include <cstdint>
+#include <string>
+
+// ===== LEARNED STRATEGY TABLE =====
+// Average strategy of the abstract betting game solved offline by
+// tools/CfrTrainer.cpp. An information set is (street, strength bucket,
+// position, call-amount class, pot class), all observable at the table, and
+// maps to one row of STRATEGY_ACTIONS probabilities in 1/255 steps. Buckets
+// are AIPlayer::strengthBucket: quickStrength, or a BucketTable postflop.
+
+enum class StrategyAction : uint8_t { FOLD, CALL, RAISE_MIN, RAISE_MAX, ALL_IN, COUNT };
+
+const int STRATEGY_ACTIONS = static_cast<int>(StrategyAction::COUNT);
+const int STRATEGY_STREETS = 4;
+const int STRATEGY_BUCKETS = 16;          // Equal-width quickStrength or BucketTable buckets
+const int STRATEGY_POSITIONS = 2;         // 0: small blind (first to act heads-up), 1: other seats
+const int STRATEGY_CALL_CLASSES = 4;      // Nothing to call, up to MIN_BET, up to MAX_BET, more
+const int STRATEGY_POT_CLASSES = 4;       // Up to 2, 6, 20 big blinds, more
+const int STRATEGY_INFOSETS = STRATEGY_STREETS * STRATEGY_BUCKETS * STRATEGY_POSITIONS
+                            * STRATEGY_CALL_CLASSES * STRATEGY_POT_CLASSES;
+
+const char STRATEGY_MAGIC[4] = {'B', 'G', 'S', 'T'};
+const uint16_t STRATEGY_VERSION = 1;
+
+struct StrategyFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint8_t streets, buckets, positions, callClasses, potClasses, actions;
+    uint32_t infosets;
+    uint64_t iterations;    // Training iterations, for reference
+    uint32_t bucketTable;   // BucketTable id postflop buckets came from, 0 for quickStrength
+    uint32_t reserved;
+};
+static_assert(sizeof(StrategyFileHeader) == 32, "Strategy header must stay 32 bytes");
+
+inline int strategyStreet(int boardCards) { return boardCards == 0 ? 0 : boardCards - 2; }
+
+inline int strategyBucket(double strength) {
+    int bucket = static_cast<int>(strength * STRATEGY_BUCKETS);
+    return bucket < 0 ? 0 : bucket >= STRATEGY_BUCKETS ? STRATEGY_BUCKETS - 1 : bucket;
+}
+
+inline int strategyCallClass(int callAmount) {
+    return callAmount <= 0 ? 0 : callAmount <= MIN_BET ? 1 : callAmount <= MAX_BET ? 2 : 3;
+}
+
+inline int strategyPotClass(int pot) {
+    return pot <= 2 * BIG_BLIND ? 0 : pot <= 6 * BIG_BLIND ? 1 : pot <= 20 * BIG_BLIND ? 2 : 3;
+}
+
+inline int strategyIndex(int street, int bucket, int position, int callClass, int potClass) {
+    return (((street * STRATEGY_BUCKETS + bucket) * STRATEGY_POSITIONS + position) * STRATEGY_CALL_CLASSES
+            + callClass) * STRATEGY_POT_CLASSES + potClass;
+}
+
+// Read-only view of a strategy file, mapped once at startup
+class StrategyTable {
+private:
+    MappedFile file;
+    const uint8_t* rows = nullptr;
+    uint32_t trainedBuckets = 0;
+
+public:
+    // False (and nothing loaded) unless the file matches this build's layout
+    bool load(const std::string& path, std::string& error);
+    bool loaded() const { return rows != nullptr; }
+    uint32_t bucketTable() const { return trainedBuckets; }   // BucketTable id it needs, 0 for none
+    // STRATEGY_ACTIONS weights summing to 255, or all zero for an information set training never reached
+    const uint8_t* row(int index) const { return rows + static_cast<size_t>(index) * STRATEGY_ACTIONS; }
+
+    static StrategyTable& global();   // The table AIPlayer reads; empty unless main loads one
+};
@@ -3,12 +3,17 @@
 #include <vector>
 #include <string>
 #include <algorithm>
-#include <random>
 #include <ctime>
+#include <cstdint>
+#include "Random.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 // ===== ENUMS AND CONSTANTS =====
-enum class Suit { HEARTS, DIAMONDS, CLUBS, SPADES };
-enum class Rank { TWO = 2, THREE, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN, JACK, QUEEN, KING, ACE };
+enum class Suit : uint8_t { HEARTS, DIAMONDS, CLUBS, SPADES };
+enum class Rank : uint8_t { TWO = 2, THREE, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN, JACK, QUEEN, KING, ACE };
 
 // ===== CARD SYSTEM =====
 struct Card {
@@ -17,23 +22,103 @@ struct Card {
     
     Card(Suit s, Rank r) : suit(s), rank(r) {}
     
-    std::string toString() const;
-    std::string toStringYours() const;    // Yellow color for your cards
-    std::string toStringBoard() const;    // Cyan color for board cards
+    // 1-byte card index: suit * 16 + (rank - 2), see CardSet
+    uint8_t index() const { return static_cast<uint8_t>((static_cast<int>(suit) << 4) | (static_cast<int>(rank) - 2)); }
+    static Card fromIndex(uint8_t index) { return Card(static_cast<Suit>(index >> 4), static_cast<Rank>((index & 15) + 2)); }
+    
+    // Pre-rendered ANSI strings, built once for all 52 cards
+    const std::string& toString() const;
+    const std::string& toStringYours() const;    // Yellow color for your cards
+    const std::string& toStringBoard() const;    // Cyan color for board cards
+};
+
+// ===== CARD SET =====
+// 64-bit set of cards: bit Card::index() = suit * 16 + (rank - 2), so each suit
+// owns one 16-bit lane holding a 13-bit rank mask. Union is one OR, membership
+// and size are single instructions, and suit masks are a shift away.
+struct CardSet {
+    uint64_t bits = 0;
+
+    static constexpr uint64_t FULL_DECK = 0x1FFF1FFF1FFF1FFFull;
+
+    constexpr CardSet() = default;
+    constexpr explicit CardSet(uint64_t b) : bits(b) {}
+    CardSet(Card card) : bits(1ull << card.index()) {}
+
+    static constexpr CardSet fullDeck() { return CardSet(FULL_DECK); }
+
+    constexpr CardSet operator|(CardSet other) const { return CardSet(bits | other.bits); }
+    constexpr CardSet operator&(CardSet other) const { return CardSet(bits & other.bits); }
+    constexpr CardSet operator-(CardSet other) const { return CardSet(bits & ~other.bits); }
+    CardSet& operator|=(CardSet other) { bits |= other.bits; return *this; }
+    CardSet& operator-=(CardSet other) { bits &= ~other.bits; return *this; }
+    constexpr bool operator==(CardSet other) const { return bits == other.bits; }
+    constexpr bool operator!=(CardSet other) const { return bits != other.bits; }
+
+    void add(Card card) { bits |= 1ull << card.index(); }
+    void remove(Card card) { bits &= ~(1ull << card.index()); }
+    bool contains(Card card) const { return (bits >> card.index()) & 1; }
+    bool contains(uint8_t index) const { return (bits >> index) & 1; }
+    constexpr bool empty() const { return bits == 0; }
+    constexpr bool intersects(CardSet other) const { return (bits & other.bits) != 0; }
+
+    int size() const {
+#if defined(_MSC_VER)
+        return static_cast<int>(__popcnt64(bits));
+#else
+        return __builtin_popcountll(bits);
+#endif
+    }
+
+    // Index of the lowest card in the set; the set must not be empty
+    uint8_t lowestIndex() const {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return static_cast<uint8_t>(index);
+#else
+        return static_cast<uint8_t>(__builtin_ctzll(bits));
+#endif
+    }
+
+    Card popLowest() {
+        uint8_t index = lowestIndex();
+        bits &= bits - 1;
+        return Card::fromIndex(index);
+    }
+
+    // 13-bit rank mask of one suit (bit 0 = TWO ... bit 12 = ACE)
+    constexpr uint32_t suitMask(int suit) const { return static_cast<uint32_t>(bits >> (suit * 16)) & 0x1FFF; }
+    uint32_t suitMask(Suit suit) const { return suitMask(static_cast<int>(suit)); }
+    // Ranks present in any suit
+    constexpr uint32_t rankMask() const { return suitMask(0) | suitMask(1) | suitMask(2) | suitMask(3); }
 };
 
+// Lazy deck: ids[0, dealt) are dealt, ids[dealt, 52) are the undealt cards in
+// any order. Each draw is one Fisher-Yates step over the undealt part, so a
+// reset only rewinds the index and a round pays for the cards it deals.
 class Deck {
+public:
+    static const int DECK_SIZE = 52;
+    
 private:
-    std::vector<Card> cards;
-    std::mt19937 rng;
+    uint8_t ids[DECK_SIZE];   // Card indices
+    uint8_t slot[64];         // Position of each card index in ids
+    uint8_t dealt;
+    CardSet undealt;          // Cards still in the deck
+    Rng rng;
+    
+    void swapSlots(uint8_t a, uint8_t b);
     
 public:
-    Deck(unsigned int seed = std::time(nullptr));
+    Deck(uint64_t seed = std::time(nullptr), uint64_t stream = 0);
     
     void reset();
-    void shuffle();
+    void shuffleRemaining();
     Card draw();
     std::vector<Card> draw(int count);
-    bool empty() const { return cards.empty(); }
-    size_t size() const { return cards.size(); }
+    bool remove(Card card);   // Takes a known card out of the deck; false if already dealt
+    bool empty() const { return dealt == DECK_SIZE; }
+    size_t size() const { return DECK_SIZE - dealt; }
+    CardSet remaining() const { return undealt; }
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 
 // Game configuration constants
 const int HP_PLAYER_INIT = 100;
@@ -7,12 +8,37 @@ const int SMALL_BLIND = 1;
 const int BIG_BLIND = 2;
 const int MIN_BET = BIG_BLIND;
 const int MAX_BET = 20;
+const int MIN_SEATS = 2;
+const int MAX_SEATS = 10;                      // Also the capacity of the fixed per-round seat containers
+const int DEFAULT_SEATS = 4;
 const double BASE_DETECT_DEFAULT = 0.05;
 const double VIGILANCE_INCREMENT_PER_WIN = 0.02;
 const double VIGILANCE_INCREMENT_PER_DETECT = 0.05;
 const double VIGILANCE_DECREMENT_PER_AI_WIN = 0.01;
 const double MAX_VIGILANCE = 0.6;
 const double CHEAT_REPEAT_PENALTY = 0.03;
+const int CHEAT_MEMORY = 5;                    // Recent cheats that count toward the repeat penalty
+const int CHEAT_ADVISOR_BUDGET_US = 50000;     // Time budget for rolling out every cheat
+const uint64_t CHEAT_ADVISOR_MAX_SAMPLES = 4096; // Rollouts per cheat, and without cheating
+const int AI_EQUITY_BUDGET_US = 2000;         // Monte Carlo time budget per AI decision at interactive tables
+const double AI_EQUITY_TARGET_ERROR = 0.01;   // Standard error at which the AI stops sampling
+const uint64_t AI_EQUITY_FIXED_SAMPLES = 8192; // Samples per AI decision without a deadline
+const uint64_t AI_EXACT_EQUITY_MAX_DEALS = 50000; // Enumerate exactly instead of sampling below this
+const float OPPONENT_STATS_DECAY = 0.97f;     // Per opportunity, so roughly the last 33 count
+const double OPPONENT_PRIOR_WEIGHT = 5.0;     // Opportunities the prior rates of an unknown seat are worth
+const double AI_OPPONENT_MAX_SHIFT = 0.15;    // Largest threshold shift opponent statistics can cause
+const int MCTS_BUDGET_US = 10000;             // Default search deadline per decision of an MCTS seat
+const int MCTS_POOL_NODES = 1 << 16;          // Tree nodes per searching seat, allocated once
+const int MCTS_MAX_DEPTH = 128;               // Actions from the root the tree follows before rolling out
+const int MCTS_MAX_RAISES = 3;                // Raises per street the searching seat considers
+const double MCTS_EXPLORATION = 0.7;          // UCB1 constant, rewards scaled to 0..1
+const int TOURNAMENT_MAX_ROUNDS = 10000;       // Games still running after this many rounds are cut off
+const int TOURNAMENT_TRACKED_ROUNDS = 200;     // Vigilance trajectory length
+const int TOURNAMENT_HP_BUCKET = 20;           // Width of the final HP histogram buckets
 
 enum class GameStage { PRE_FLOP, FLOP, TURN, RIVER, SHOWDOWN };
-enum class PlayerAction { FOLD, CALL, RAISE, ALL_IN, NONE };
\ No newline at end of file
+enum class PlayerAction { FOLD, CALL, RAISE, ALL_IN, NONE };
+
+// Dense cheat ids; the values are written to hand history records, so append only
+enum class CheatId : uint8_t { SWAP_HANDS, PEEK_OPPONENT_HOLE, MUCK_SWAP, FORCE_FOLD, STACK_PEEK, CARD_MARKING, BLUFF_BOOST, COUNT };
+const int CHEAT_COUNT = static_cast<int>(CheatId::COUNT);
\ No newline at end of file
@@ -1,20 +1,43 @@
 #pragma once
 #include "Card.h"
 #include <vector>
-#include <unordered_map>
+#include <cstdint>
+#include <string>
 
 enum class HandRank { HIGH_CARD, PAIR, TWO_PAIR, THREE_KIND, STRAIGHT, FLUSH, FULL_HOUSE, FOUR_KIND, STRAIGHT_FLUSH, ROYAL_FLUSH };
 
+// A packed strength (see HandEvaluator::evaluate): category, primary ranks and
+// kickers in one integer, so hands compare with a single integer comparison.
+// The text is only built when a result is shown.
 struct HandValue {
-    HandRank rank;
-    std::vector<int> tieBreakers;
-    std::string description; // Thêm mô tả lý do thắng
-    
-    bool operator>(const HandValue& other) const;
-    std::string getDescription() const;
+    uint32_t strength = 0;
+
+    HandRank rank() const;
+    std::string description() const;   // e.g. "Full House, Queens over Fours"
+
+    bool operator>(const HandValue& other) const { return strength > other.strength; }
+    bool operator<(const HandValue& other) const { return strength < other.strength; }
+    bool operator==(const HandValue& other) const { return strength == other.strength; }
 };
 
 class HandEvaluator {
 public:
-    static HandValue evaluateHand(const std::vector<Card>& allCards);
-};
\ No newline at end of file
+    static HandValue evaluateHand(const std::vector<Card>& allCards) { return {evaluate(allCards)}; }
+
+    // Table-driven evaluation of 5-7 cards into a packed uint32_t strength.
+    // Comparing two strengths is the same as comparing the two hands.
+    static uint32_t evaluate(const Card* cards, size_t count);
+    static uint32_t evaluate(const std::vector<Card>& cards) { return evaluate(cards.data(), cards.size()); }
+    static uint32_t evaluate(CardSet cards);
+    // Same evaluation from one 13-bit rank mask per suit
+    static uint32_t evaluateSuits(uint32_t hearts, uint32_t diamonds, uint32_t clubs, uint32_t spades);
+
+    // Evaluates n card sets into out[0..n). Picks the AVX2 path at runtime when
+    // the CPU has it; every path returns the same strengths as evaluate().
+    static void evaluateBatch(const CardSet* hands, uint32_t* out, size_t n);
+    static void evaluateBatchScalar(const CardSet* hands, uint32_t* out, size_t n);
+    static void evaluateBatchAvx2(const CardSet* hands, uint32_t* out, size_t n);
+    static bool avx2Supported();
+
+    static HandRank rankOf(uint32_t strength);
+};
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+// ===== HAND EVALUATION LOOKUP TABLES =====
+// Every table is indexed by a 13-bit rank mask (bit 0 = TWO ... bit 12 = ACE).
+// Packed strength layout: category in bits 26-29, primary ranks mask in bits 13-25,
+// kicker ranks mask in bits 0-12. A larger value is always a better hand.
+
+const int RANK_MASK_SIZE = 1 << 13;
+const int STRENGTH_CATEGORY_SHIFT = 26;
+const int STRENGTH_PRIMARY_SHIFT = 13;
+
+struct HandTables {
+    uint32_t flush[RANK_MASK_SIZE];     // 0 unless >= 5 bits; flush or straight flush strength
+    uint32_t straight[RANK_MASK_SIZE];  // 0 unless the mask holds a straight
+    uint16_t top1[RANK_MASK_SIZE];      // highest set bit of the mask
+    uint16_t top2[RANK_MASK_SIZE];      // two highest set bits
+    uint16_t top3[RANK_MASK_SIZE];
+    uint16_t top5[RANK_MASK_SIZE];
+    uint16_t padding[2];                // keeps 32-bit gathers of the last top5 entry in bounds
+};
+
+extern const HandTables HAND_TABLES;
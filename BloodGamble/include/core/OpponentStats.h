@@ -0,0 +1,75 @@
+#pragma once
+#include "Config.h"
+#include <atomic>
+#include <cstdint>
+
+// ===== OPPONENT STATISTICS =====
+// How one seat has been playing, as seen from the table. Every rate is a
+// numerator and a denominator decayed together by OPPONENT_STATS_DECAY at
+// each opportunity, so recent play counts most and an update is O(1).
+//
+// Only the game thread writes. Counters are relaxed atomics behind a
+// sequence number, so any thread can take a consistent snapshot without
+// locking, and copies of a GameState carry the statistics along.
+
+enum class StatCounter : uint8_t {
+    HANDS, VPIP, PREFLOP_RAISES,     // Hands acted on preflop; voluntarily paid; raised
+    AGGRESSIVE, PASSIVE,             // Postflop bets and raises; calls of a bet
+    RAISES_FACED, FOLDS_TO_RAISE,
+    FLOPS_SEEN, SHOWDOWNS,
+    CHEATS, CHEATS_DETECTED,
+    COUNT
+};
+const int STAT_COUNTERS = static_cast<int>(StatCounter::COUNT);
+
+// Snapshot of the counters; rates start at a prior and move toward what was seen
+struct OpponentProfile {
+    // What an unknown seat is assumed to do, worth OPPONENT_PRIOR_WEIGHT opportunities
+    static constexpr double PRIOR_VPIP = 0.4;
+    static constexpr double PRIOR_PREFLOP_RAISE = 0.15;
+    static constexpr double PRIOR_AGGRESSION_FACTOR = 1.0;
+    static constexpr double PRIOR_FOLD_TO_RAISE = 0.4;
+    static constexpr double PRIOR_SHOWDOWN = 0.3;
+
+    float counters[STAT_COUNTERS] = {};
+
+    float operator[](StatCounter counter) const { return counters[static_cast<int>(counter)]; }
+
+    double vpip() const;               // Share of hands with money put in voluntarily preflop
+    double preflopRaise() const;       // Share of hands raised preflop
+    double aggressionFactor() const;   // Postflop bets and raises per call
+    double foldToRaise() const;        // Share of bets and raises faced that were folded to
+    double showdownRate() const;       // Share of flops seen that went to showdown
+    double cheatsDetected() const { return (*this)[StatCounter::CHEATS_DETECTED]; }   // Decayed count
+    double hands() const { return (*this)[StatCounter::HANDS]; }
+};
+
+class OpponentStats {
+private:
+    std::atomic<uint32_t> sequence{0};   // Odd while the game thread is writing
+    std::atomic<float> counters[STAT_COUNTERS];
+    int handRound = -1;                  // Game thread only: round of the preflop flags
+    bool paidThisHand = false;
+    bool raisedThisHand = false;
+
+    void beginWrite();
+    void endWrite();
+    float get(StatCounter counter) const { return counters[static_cast<int>(counter)].load(std::memory_order_relaxed); }
+    void set(StatCounter counter, float value) { counters[static_cast<int>(counter)].store(value, std::memory_order_relaxed); }
+    // One more opportunity for the pair: both decay, the numerator gains `hit`
+    void observe(StatCounter numerator, StatCounter denominator, bool hit);
+
+public:
+    OpponentStats();
+    OpponentStats(const OpponentStats& other);
+    OpponentStats& operator=(const OpponentStats& other);
+
+    // Game thread, as each action resolves; facingRaise: callAmount comes from a bet or raise
+    void onAction(int round, GameStage stage, PlayerAction action, int callAmount, bool facingRaise);
+    void onFlopSeen();
+    void onShowdown();
+    void onCheat(bool detected);
+
+    // Any thread, never blocks the game thread
+    OpponentProfile read() const;
+};
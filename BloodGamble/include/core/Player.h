@@ -1,8 +1,10 @@
 #pragma once
 #include "Card.h"
+#include "Config.h"
+#include "OpponentStats.h"
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <array>
 
 class Player {
 public:
@@ -10,17 +12,22 @@ public:
     bool isHuman;
     int hp;
     std::vector<Card> hand;
+    CardSet handMask;      // Same cards as hand, for evaluation
     bool folded;
     bool allIn;
-    std::unordered_map<std::string, int> cheatCooldowns;
+    std::array<uint8_t, CHEAT_COUNT> cheatCooldowns;   // Rounds left, indexed by CheatId
     double suspicion;
     double aggression;
     double tightness;
+    OpponentStats stats;   // How this seat has played, as the table saw it
     
     Player(int playerId, bool human, int initialHp);
     
     void dealCards(const std::vector<Card>& cards);
+    void dealCards(Card first, Card second);
+    void setHand(const std::vector<Card>& cards);
+    void setHand(Card first, Card second);   // Reuses the hand's storage
     bool canBet(int amount) const;
     void decreaseCooldowns();
-    bool canUseCheat(const std::string& cheatName) const;
+    bool canUseCheat(CheatId cheat) const { return cheatCooldowns[static_cast<int>(cheat)] == 0; }
 };
\ No newline at end of file
@@ -0,0 +1,183 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+// ===== RANDOM NUMBER GENERATORS =====
+// Small, fast generators with non-overlapping streams. One master seed gives
+// every deck, table and thread its own stream: Rng(seed, stream) or split().
+// Build with -DBLOODGAMBLE_RNG_PHILOX (make RNG=philox) for the counter-based
+// generator; both satisfy UniformRandomBitGenerator.
+
+inline uint64_t splitMix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Seed of stream `index` of `master` in O(1). splitMix64 is a bijection, so one
+// master gives every index its own 64-bit seed
+inline uint64_t streamSeed(uint64_t master, uint64_t index) {
+    return splitMix64(master ^ splitMix64(index));
+}
+
+// xoshiro256** (Blackman & Vigna); jump() skips 2^128 outputs
+class Xoshiro256 {
+private:
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    using result_type = uint64_t;
+
+    // Runs jump() `stream` times (256 steps each), so the cost grows with the
+    // stream number. Fine for the handful used per table or worker thread;
+    // for many streams, split() one generator in turn or seed each one with
+    // streamSeed(seed, index).
+    explicit Xoshiro256(uint64_t seed = 0, uint64_t stream = 0) {
+        uint64_t x = seed;
+        for (uint64_t& word : s) {
+            word = splitMix64(x);
+            x += 0x9E3779B97F4A7C15ull;
+        }
+        for (uint64_t i = 0; i < stream; i++) {
+            jump();
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint64_t>::max(); }
+
+    result_type operator()() {
+        uint64_t result = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    void jump() {
+        static const uint64_t JUMP[4] = {0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                         0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+        uint64_t next[4] = {0, 0, 0, 0};
+        for (uint64_t word : JUMP) {
+            for (int bit = 0; bit < 64; bit++) {
+                if (word & (1ull << bit)) {
+                    for (int i = 0; i < 4; i++) next[i] ^= s[i];
+                }
+                (*this)();
+            }
+        }
+        for (int i = 0; i < 4; i++) s[i] = next[i];
+    }
+
+    // Returns the current stream and moves this generator past it
+    Xoshiro256 split() {
+        Xoshiro256 child = *this;
+        jump();
+        return child;
+    }
+};
+
+// Philox4x32-10 (Salmon et al.); the key selects the seed, the top counter word
+// the stream, so jump() is a single increment
+class Philox4x32 {
+private:
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t block[4];
+    int used = 4;   // Words of `block` already returned
+
+    static void mulHiLo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+        uint64_t product = static_cast<uint64_t>(a) * b;
+        hi = static_cast<uint32_t>(product >> 32);
+        lo = static_cast<uint32_t>(product);
+    }
+
+    void generate() {
+        uint32_t x[4] = {counter[0], counter[1], counter[2], counter[3]};
+        uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; round++) {
+            uint32_t hi0, lo0, hi1, lo1;
+            mulHiLo(0xD2511F53u, x[0], hi0, lo0);
+            mulHiLo(0xCD9E8D57u, x[2], hi1, lo1);
+            x[0] = hi1 ^ x[1] ^ k0;
+            x[1] = lo1;
+            x[2] = hi0 ^ x[3] ^ k1;
+            x[3] = lo0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        for (int i = 0; i < 4; i++) block[i] = x[i];
+        used = 0;
+        // 96-bit block counter; the top word is the stream
+        if (++counter[0] == 0 && ++counter[1] == 0) ++counter[2];
+    }
+
+public:
+    using result_type = uint64_t;
+
+    explicit Philox4x32(uint64_t seed = 0, uint64_t stream = 0) {
+        uint64_t mixed = splitMix64(seed);
+        key[0] = static_cast<uint32_t>(mixed);
+        key[1] = static_cast<uint32_t>(mixed >> 32);
+        counter[0] = counter[1] = counter[2] = 0;
+        counter[3] = static_cast<uint32_t>(stream);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint64_t>::max(); }
+
+    result_type operator()() {
+        if (used > 2) generate();
+        uint64_t result = (static_cast<uint64_t>(block[used]) << 32) | block[used + 1];
+        used += 2;
+        return result;
+    }
+
+    void jump() {
+        counter[3]++;
+        counter[0] = counter[1] = counter[2] = 0;
+        used = 4;
+    }
+
+    Philox4x32 split() {
+        Philox4x32 child = *this;
+        jump();
+        return child;
+    }
+};
+
+#ifdef BLOODGAMBLE_RNG_PHILOX
+using Rng = Philox4x32;
+#else
+using Rng = Xoshiro256;
+#endif
+
+// Uniform index in [0, range) from the high 32 bits of a draw (Lemire). The
+// few products whose low word falls below 2^32 mod range are redrawn; the
+// division only runs when the low word is already under range.
+template <typename Generator>
+inline uint32_t bounded(Generator& rng, uint32_t range) {
+    uint64_t product = (rng() >> 32) * range;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < range) {
+        uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = (rng() >> 32) * range;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+// Uniform double in [0, 1) with 53 random bits
+template <typename Generator>
+inline double uniform01(Generator& rng) {
+    return static_cast<double>(rng() >> 11) * 0x1.0p-53;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include <charconv>
+#include <type_traits>
+
+// ===== TERMINAL RENDERER =====
+// Builds a whole screen into one reusable buffer and writes it to stdout in a
+// single call on flush(). Flush before reading input so prompts are visible.
+// As a null sink every write returns immediately and nothing is buffered.
+class Renderer {
+private:
+    std::string buffer;
+    bool nullSink;
+
+public:
+    explicit Renderer(bool silent = false) : nullSink(silent) { buffer.reserve(4096); }
+
+    void setNullSink(bool silent) { nullSink = silent; buffer.clear(); }
+    bool isNullSink() const { return nullSink; }
+
+    Renderer& operator<<(const std::string& text) {
+        if (!nullSink) buffer += text;
+        return *this;
+    }
+
+    Renderer& operator<<(const char* text) {
+        if (!nullSink) buffer += text;
+        return *this;
+    }
+
+    Renderer& operator<<(char c) {
+        if (!nullSink) buffer += c;
+        return *this;
+    }
+
+    template <typename T, typename = std::enable_if_t<std::is_integral<T>::value>>
+    Renderer& operator<<(T value) {
+        if (!nullSink) {
+            char digits[24];
+            auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            buffer.append(digits, result.ptr);
+        }
+        return *this;
+    }
+
+    Renderer& fixed(double value, int precision);      // Like std::fixed << std::setprecision
+    Renderer& rule(char c = '=', int width = 50);       // Horizontal separator line
+    void flush();
+};
@@ -1,24 +1,56 @@
 #pragma once
 #include "GameState.h"
+#include "PlayerPolicy.h"
 #include "../ai/AIPlayer.h"
 #include "../core/HandEvaluator.h"
+#include <memory>
+
+// Outcome of one playRound call
+struct RoundSummary {
+    int winnerId = -1;           // First winner after the dealer; -1 when nobody collected the pot
+    int pot = 0;
+    bool showdown = false;
+    uint32_t winnerMask = 0;     // Every seat that won a main or side pot
+    int won[MAX_SEATS] = {};     // HP each seat won, uncalled HP it took back not included
+
+    int shareOf(int seat) const { return won[seat]; }
+};
 
 class BloodGambleGame {
 private:
     GameState gameState;
-    
+    std::vector<std::unique_ptr<PlayerPolicy>> policies;  // One per seat
+    bool headless;                                        // No console input or output
+    RoundSummary lastRound;
+
 public:
-    BloodGambleGame(unsigned int seed = std::time(nullptr));
-    
+    // Headless games seat fast AI policies everywhere, including human seats; `stream`
+    // picks one of many tables of the same master seed (GameState)
+    BloodGambleGame(uint64_t seed = std::time(nullptr), bool headless = false,
+                    const TableSetup& table = TableSetup(), uint64_t stream = 0);
+    // Headless copy of a game in progress for rollouts: no history, fast AI in every seat
+    explicit BloodGambleGame(const GameState& state);
+
     void run();
-    
+    RoundSummary playRound();
+    RoundSummary finishRound();   // Rest of the round in progress, from a fresh betting pass on this stage
+    void setPolicy(int seat, std::unique_ptr<PlayerPolicy> policy);
+    void setHistory(HandHistory* history);   // Logs GAME_START, then every round
+
+    GameState& getState() { return gameState; }
+
 private:
-    void playRound();
+    RoundSummary playStages(GameStage from);
     void postBlinds();
+    void postBlind(int seat, int amount);
     void bettingRound();
-    bool handlePlayerAction(Player& player, int currentBet, int playerIndex);
-    bool handleAIAction(Player& ai, int currentBet, int aiIndex);
+    bool applyDecision(int seat, const Decision& decision, int currentBet);
+    bool applyAction(int seat, const Decision& decision, int callAmount);
+    void dealBoard(int count);
+    void showBoard(const char* title);
     void showdown();
-    void awardPot(int winnerId);
+    // Main and side pots among the seats in the hand (splitPots), odd chips to the first winner after
+    // the dealer; strength is per seat, nullptr when one seat is left
+    void awardPot(const uint32_t* strength);
     void endGame();
-};
\ No newline at end of file
+};
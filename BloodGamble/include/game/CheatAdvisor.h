@@ -0,0 +1,40 @@
+#pragma once
+#include "GameState.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// Rollout estimate of one option: the user's HP change from now to the end of the round
+struct CheatOutcome {
+    bool ready = false;            // Off cooldown; cheats on cooldown are not rolled out
+    double detectProbability = 0.0;
+    uint64_t samples = 0;
+    uint64_t detected = 0;
+    double meanHpDelta = 0.0;
+    double variance = 0.0;
+};
+
+struct CheatAdvice {
+    int userSeat = -1;
+    int target = -1;                                 // Target used for targeted cheats
+    std::array<CheatOutcome, CHEAT_COUNT> cheats;    // Indexed by CheatId
+    CheatOutcome noCheat;                            // Baseline: play on without cheating
+};
+
+// Monte Carlo cheat advisor. Each rollout copies the live GameState, redeals the
+// cards the user cannot see, runs executeCheat on the copy (detection roll,
+// penalty or effect) and plays the round out with the fast AI in every seat.
+// Rollouts run in blocks spread across all options, so every cheat gets a
+// share of the time budget; block k of an option always uses the same seed.
+class CheatAdvisor {
+public:
+    struct Settings {
+        int threads = 1;
+        uint64_t seed = 0;
+        uint64_t maxSamples = CHEAT_ADVISOR_MAX_SAMPLES;
+        std::chrono::microseconds timeBudget{CHEAT_ADVISOR_BUDGET_US};   // 0 = no deadline
+    };
+
+    static CheatAdvice advise(const GameState& state, int userSeat, int targetId, const Settings& settings);
+    static void report(const CheatAdvice& advice, Renderer& out);
+};
@@ -1,30 +1,50 @@
 #pragma once
 #include "../core/Player.h"
-#include <functional>
+#include "../core/Config.h"
+#include <array>
+#include <string>
+
+class GameState;
 
 enum class DetectionSeverity { SMALL, MAJOR };
 
+using CheatEffect = void (*)(Player* user, Player* target, GameState* game);
+
 struct CheatType {
-    std::string name;
-    std::string description;
+    const char* name;
+    const char* description;
     double baseDetect;
     DetectionSeverity severity;
     int hpPenalty;
     int cooldown;
-    std::function<void(Player*, Player*, class GameState*)> effect;
-    
-    CheatType() = default;  // Default constructor
-    CheatType(const std::string& n, const std::string& desc, double bd, DetectionSeverity sev, int hp, int cd);
+    CheatId id;             // Index in the cheat table, used in hand history records
+    CheatEffect effect;
+};
+
+// The last CHEAT_MEMORY cheats in a fixed ring, with a use count per cheat kept
+// in step, so the repeat penalty is a single read
+struct RecentCheats {
+    CheatId ring[CHEAT_MEMORY];
+    uint8_t next = 0;    // Slot the next push overwrites
+    uint8_t size = 0;
+    std::array<uint8_t, CHEAT_COUNT> uses{};
+
+    void push(CheatId id) {
+        if (size == CHEAT_MEMORY) uses[static_cast<int>(ring[next])]--;
+        else size++;
+        ring[next] = id;
+        uses[static_cast<int>(id)]++;
+        next = static_cast<uint8_t>((next + 1) % CHEAT_MEMORY);
+    }
+    int count(CheatId id) const { return uses[static_cast<int>(id)]; }
 };
 
+// Compile-time cheat table indexed by CheatId. Names are only for the UI and
+// logs: parse() turns typed input into an id, and everything past it uses ids.
 class CheatSystem {
-private:
-    std::unordered_map<std::string, CheatType> cheatTypes;
-    
 public:
-    CheatSystem();
-    
-    void initializeCheatTypes();
-    const std::unordered_map<std::string, CheatType>& getCheatTypes() const { return cheatTypes; }
-    const CheatType* getCheat(const std::string& name) const;
-};
\ No newline at end of file
+    static const CheatType& get(CheatId id);
+    static const CheatType* getCheatById(int id);   // nullptr outside the table
+    static bool parse(const std::string& name, CheatId& id);
+    static int index(CheatId id) { return static_cast<int>(id); }
+};
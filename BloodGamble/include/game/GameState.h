@@ -3,40 +3,135 @@
 #include "../core/Card.h"
 #include "CheatSystem.h"
 #include "../core/Config.h"
+#include "../core/Renderer.h"
+#include "HandHistory.h"
 #include <vector>
-#include <random>
+#include <algorithm>
 #include <ctime>
 
+// Fixed-capacity list of seat indices, so per-round bookkeeping never allocates
+struct SeatList {
+    int seats[MAX_SEATS];
+    int count = 0;
+
+    void push(int seat) { seats[count++] = seat; }
+    bool contains(int seat) const { return std::find(begin(), end(), seat) != end(); }
+    size_t size() const { return static_cast<size_t>(count); }
+    bool empty() const { return count == 0; }
+    int operator[](size_t i) const { return seats[i]; }
+    const int* begin() const { return seats; }
+    const int* end() const { return seats + count; }
+};
+
+// ===== SEAT MASKS =====
+// Bit i stands for seat i
+inline uint32_t seatBit(int seat) { return 1u << seat; }
+
+inline int seatCount(uint32_t mask) {
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt(mask));
+#else
+    return __builtin_popcount(mask);
+#endif
+}
+
+// First seat of a non-empty mask at or after `from`, wrapping past the last seat
+inline int nextSeat(uint32_t mask, int from) {
+    uint32_t ahead = mask & (~0u << from);
+    uint32_t bits = ahead ? ahead : mask;
+#if defined(_MSC_VER)
+    unsigned long seat;
+    _BitScanForward(&seat, bits);
+    return static_cast<int>(seat);
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+// ===== SIDE POTS =====
+// The pot cut into layers at each contender's total stake. A layer goes to the
+// best hands among the contenders who paid all of it, split evenly with odd
+// chips to the first of them at or after `oddChipSeat`; folded seats' HP stays
+// in the layers it reached, and HP no other seat matched goes back.
+struct PotSplit {
+    int won[MAX_SEATS] = {};        // From layers another seat paid into too
+    int refunded[MAX_SEATS] = {};   // Own HP nobody matched
+    uint32_t winners = 0;           // Seats with something in won
+};
+
+// contributed: HP each seat put in this round, folded seats included; strength:
+// higher wins, or nullptr when the contenders tie (a single seat left, say)
+PotSplit splitPots(const int* contributed, int seats, uint32_t contenders, const uint32_t* strength, int oddChipSeat);
+
+// Table size and which seats are human; every other seat is an AI
+struct TableSetup {
+    int seats = DEFAULT_SEATS;
+    uint32_t humanMask = 1;   // Bit i = seat i is human
+    uint32_t mctsMask = 0;    // AI seats that search with MctsPolicy instead of AIPolicy
+    int mctsBudgetUs = MCTS_BUDGET_US;
+};
+
 class GameState {
 public:
     std::vector<Player> players;
     Deck deck;
     std::vector<Card> board;
+    CardSet boardMask;     // Same cards as board, for evaluation
     int pot;
     int dealerIndex;
     int smallBlindIndex;
     int bigBlindIndex;
     std::vector<int> currentBets;
+    std::vector<int> contributed;   // HP each seat put in the pot this round, for side pots
+    uint32_t inHandMask;   // Seats dealt this round and not folded, all-in seats included
+    uint32_t allInMask;    // Seats with no HP left to bet
+    uint32_t pendingMask;  // Seats still to act in the current betting pass, the one deciding excluded
+    uint32_t humanMask;    // Human seats, fixed for the game
     GameStage stage;
     double vigilance;
     int roundNumber;
-    std::mt19937 rng;
-    std::vector<std::string> recentCheats; // For repeat penalty calculation
+    uint64_t seed;         // Table seed: the deck draws from its stream 0, detection rolls from stream 1
+    Rng rng;               // Detection rolls, on a separate stream from the deck
+    RecentCheats recentCheats;             // For the repeat penalty
     
-    CheatSystem cheatSystem;
+    Renderer renderer;     // All game screens; a null sink in headless games
+    HandHistory* history;  // Optional binary log of the game, not owned
     
-    GameState(unsigned int seed = std::time(nullptr));
+    // Table `stream` of master seed `seed` (streamSeed); stream 0 is the master itself, so a
+    // logged table seed replays as it is. Throws std::invalid_argument unless MIN_SEATS <= seats <= MAX_SEATS
+    GameState(uint64_t seed = std::time(nullptr), const TableSetup& table = TableSetup(), uint64_t stream = 0);
     
     // Cheat functions
-    double computeDetectionProbability(const std::string& cheatName, int targetId, GameStage currentStage);
-    bool executeCheat(const std::string& cheatName, int targetId = -1);
-    void showCheatList();
+    double computeDetectionProbability(CheatId cheat, int targetId, GameStage currentStage) const;
+    // Every cheat at once, indexed by CheatId; the shared factors are computed once
+    std::array<double, CHEAT_COUNT> computeDetectionProbabilities(int targetId, GameStage currentStage) const;
+    bool cheatReady(CheatId cheat, int userSeat);   // Explains on the renderer when not
+    // False when the cheat was not ready; `detected`, if given, receives the detection roll's outcome
+    bool executeCheat(CheatId cheat, int targetId, int userSeat, bool* detected = nullptr);
+    void showCheatList(int userSeat);
+    
+    // Board functions
+    void addBoardCard(const Card& card);
+    void clearBoard();
+    
+    // Hand history, no-op without a log
+    void record(RecordType type, int seat, int code = 0, int flag = 0, int32_t amount = 0, uint32_t value = 0) {
+        if (history) {
+            history->record({type, static_cast<uint8_t>(seat), static_cast<uint8_t>(code), static_cast<uint8_t>(flag),
+                             static_cast<uint32_t>(roundNumber), amount, value});
+        }
+    }
+    
+    // Detection scale shared by all cheats: vigilance, target suspicion and stage
+    double detectionScale(int targetId, GameStage currentStage) const;
     
     // Game state functions
     void updateVigilanceAfterRound(bool playerWon);
-    std::vector<int> getActivePlayers();
+    SeatList getActivePlayers() const;   // Seats in inHandMask
     bool gameOver();
-    void displayStatus();
+    bool humanAlive() const;
+    void displayStatus(int viewerSeat);
+    bool isYou(int seat) const { return humanMask == seatBit(seat); }   // The table's only human
     
     // Accessors
     Deck& getDeck() { return deck; }
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// ===== HAND HISTORY FORMAT =====
+// A 16-byte file header followed by 16-byte records, appended in play order.
+// Several games may follow each other in one file, each opened by GAME_START.
+const char HISTORY_MAGIC[4] = {'B', 'G', 'H', 'H'};
+const uint16_t HISTORY_VERSION = 4;
+const uint8_t HISTORY_NO_SEAT = 0xFF;
+
+enum class RecordType : uint8_t {
+    GAME_START,     // seat = player count, amount = human seat mask, value/round = low/high half of GameState::seed
+    ROUND_START,    // seat = dealer, value = vigilance in millionths before the round
+    DEAL,           // seat, code/flag = Card::index() of both hole cards
+    BOARD,          // code = Card::index(), flag = board position 0-4
+    ACTION,         // seat, code = PlayerAction, flag = GameStage, amount = HP moved, value = raise asked
+    CHEAT,          // seat, code = CheatId, flag = detected, amount = target, value = roll * 2^32
+    SHOWDOWN,       // seat, code = HandRank, value = packed hand strength
+    AWARD,          // seat = winner, amount = main and side pots won, flag = several winners; one per winner
+    REFUND          // seat, amount = HP it put in that no other seat matched, before the AWARD records
+};
+
+struct HistoryFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t reserved[2];
+};
+
+struct HistoryRecord {
+    RecordType type;
+    uint8_t seat;
+    uint8_t code;
+    uint8_t flag;
+    uint32_t round;
+    int32_t amount;
+    uint32_t value;
+
+    bool operator==(const HistoryRecord& other) const {
+        return type == other.type && seat == other.seat && code == other.code && flag == other.flag
+            && round == other.round && amount == other.amount && value == other.value;
+    }
+};
+
+static_assert(sizeof(HistoryFileHeader) == 16, "History header must stay 16 bytes");
+static_assert(sizeof(HistoryRecord) == 16, "History records must stay 16 bytes");
+
+// Writes records to an append-only file, or in replay mode checks every
+// record the game produces against the next one of a loaded log. Each round
+// reaches the file when it ends, so a crash loses at most the round in play;
+// batched logs (headless simulations) only write every BUFFER_RECORDS.
+class HandHistory {
+private:
+    static const size_t BUFFER_RECORDS = 4096;
+
+    std::FILE* file = nullptr;
+    std::vector<HistoryRecord> buffer;
+    std::vector<HistoryRecord> expected;    // Replay mode only
+    size_t cursor = 0;
+    size_t mismatchCount = 0;
+    size_t firstMismatch = SIZE_MAX;
+    bool replayMode = false;
+    bool batched = false;
+
+    void flushBuffer();
+    void verify(const HistoryRecord& r);
+
+public:
+    HandHistory() = default;
+    ~HandHistory();
+    HandHistory(const HandHistory&) = delete;
+    HandHistory& operator=(const HandHistory&) = delete;
+
+    // Appends; writes the header to a new file, fails on a file of another format or version
+    bool openWrite(const std::string& path, bool batch = false);
+    bool openReplay(const std::string& path);  // Loads the whole log for verification
+    void close();
+    void endRound();   // Writes the round's records through to the file unless batched
+
+    void record(const HistoryRecord& r) {
+        if (replayMode) {
+            verify(r);
+            return;
+        }
+        buffer.push_back(r);
+        if (buffer.size() == BUFFER_RECORDS) flushBuffer();
+    }
+
+    // Replay mode: the record the game is expected to produce next, or nullptr at the end
+    const HistoryRecord* peek() const { return cursor < expected.size() ? &expected[cursor] : nullptr; }
+    // Replay mode: counts the expected record as a mismatch and moves past it
+    void reject() {
+        if (firstMismatch == SIZE_MAX) firstMismatch = cursor;
+        mismatchCount++;
+        if (cursor < expected.size()) cursor++;
+    }
+    size_t position() const { return cursor; }
+    const std::vector<HistoryRecord>& records() const { return expected; }
+    size_t mismatches() const { return mismatchCount; }
+    size_t firstMismatchIndex() const { return firstMismatch; }
+};
@@ -0,0 +1,48 @@
+#pragma once
+#include "../core/Config.h"
+#include "../ai/Mcts.h"
+
+class GameState;
+
+struct Decision {
+    PlayerAction action;
+    int raiseAmount;    // HP on top of the call amount, for RAISE
+};
+
+// Chooses the action of one seat; BloodGambleGame applies it to the table
+class PlayerPolicy {
+public:
+    virtual ~PlayerPolicy() = default;
+    virtual Decision decide(GameState& game, int seat, int callAmount) = 0;
+};
+
+// Console menu for a human seat, including the cheat and status screens
+class HumanPolicy : public PlayerPolicy {
+public:
+    Decision decide(GameState& game, int seat, int callAmount) override;
+};
+
+// AIPlayer's decision rule. Quick mode replaces the equity engine with table
+// lookups so headless simulations never sample or spawn threads; otherwise
+// the table is interactive and the engine samples within its deadline.
+class AIPolicy : public PlayerPolicy {
+private:
+    bool quick;
+
+public:
+    explicit AIPolicy(bool quickStrength = false) : quick(quickStrength) {}
+    Decision decide(GameState& game, int seat, int callAmount) override;
+};
+
+// Information-set MCTS within a deadline per decision (MctsSearch). The tree
+// is kept between this seat's actions in a hand; search time never touches
+// the game's RNG streams, and replays use the logged decisions.
+class MctsPolicy : public PlayerPolicy {
+private:
+    MctsSearch search;
+    MctsSearch::Settings settings;
+
+public:
+    explicit MctsPolicy(const MctsSearch::Settings& searchSettings) : settings(searchSettings) {}
+    Decision decide(GameState& game, int seat, int callAmount) override;
+};
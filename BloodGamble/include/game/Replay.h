@@ -0,0 +1,29 @@
+#pragma once
+#include "PlayerPolicy.h"
+#include "HandHistory.h"
+#include <ostream>
+#include <string>
+
+
+// Plays back the decisions of one seat from a hand history, re-running the
+// cheats logged before each of them so every roll and draw happens again
+class ReplayPolicy : public PlayerPolicy {
+public:
+    Decision decide(GameState& game, int seat, int callAmount) override;
+};
+
+struct ReplayResult {
+    uint64_t games = 0;
+    uint64_t rounds = 0;
+    size_t records = 0;
+    size_t mismatches = 0;
+    size_t firstMismatch = SIZE_MAX;   // Record index, SIZE_MAX when the replay matched
+};
+
+class Replay {
+public:
+    // Rebuilds every game of a log opened with HandHistory::openReplay from its
+    // seed, checking each regenerated record. Prints round `round` of game `game`.
+    static ReplayResult run(HandHistory& log, int game, int round, std::ostream& out);
+    static std::string describe(const HistoryRecord& r);
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include "GameState.h"
+#include <cstdint>
+#include <vector>
+#include <ostream>
+
+class HandHistory;
+
+// Aggregates of a headless AI-vs-AI run
+struct SimulationStats {
+    uint64_t hands = 0;
+    uint64_t games = 0;           // Finished games; a new one starts whenever gameOver()
+    uint64_t showdowns = 0;
+    uint64_t humanSeatWins = 0;   // Finished games a human seat survived
+    std::vector<uint64_t> potsWon;
+    std::vector<uint64_t> hpWon;
+    double seconds = 0.0;
+
+    double handsPerSecond() const { return seconds > 0.0 ? hands / seconds : 0.0; }
+};
+
+class Simulator {
+public:
+    // Plays `hands` rounds; game g of the run is seeded with seed + g.
+    // Every game is appended to `history` when one is given.
+    static SimulationStats run(uint64_t hands, uint64_t seed, HandHistory* history = nullptr,
+                               const TableSetup& table = TableSetup());
+    static void report(const SimulationStats& stats, std::ostream& out);
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include "../core/Config.h"
+#include "GameState.h"
+#include <cstdint>
+#include <vector>
+#include <ostream>
+
+// Merged results of many independent headless games. Every field is an
+// integer sum, so merging per-thread results gives the same totals in any order.
+struct TournamentResult {
+    uint64_t games = 0;
+    uint64_t humanSeatWins = 0;     // A human seat survived
+    uint64_t aiWins = 0;
+    uint64_t unfinished = 0;        // Stopped at the round cap
+    uint64_t totalRounds = 0;
+    std::vector<uint64_t> survivors;           // Per seat: alive when the game ended
+    std::vector<uint64_t> vigilanceMicros;     // Per round: sum of vigilance * 1e6 after that round
+    std::vector<uint64_t> vigilanceGames;      // Per round: games that played it
+    std::vector<uint64_t> humanHpHistogram;    // Final HP of every human seat, TOURNAMENT_HP_BUCKET wide buckets
+    std::vector<uint64_t> aiHpHistogram;       // Final HP of every AI seat
+
+    void merge(const TournamentResult& other);
+    double averageRounds() const { return games ? static_cast<double>(totalRounds) / games : 0.0; }
+};
+
+class TournamentRunner {
+public:
+    struct Settings {
+        uint64_t games = 1000;
+        uint64_t masterSeed = 1;
+        int threads = 1;
+        int maxRounds = TOURNAMENT_MAX_ROUNDS;
+        TableSetup table;
+    };
+
+    // Game g plays table stream g of masterSeed, so no two games share a deal and results
+    // do not depend on the thread count
+    static TournamentResult run(const Settings& settings);
+    static void report(const TournamentResult& result, std::ostream& out);
+};
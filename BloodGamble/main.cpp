@@ -1,18 +1,191 @@
 #include "include/game/BloodGambleGame.h"
+#include "include/game/Simulator.h"
+#include "include/game/TournamentRunner.h"
+#include "include/game/Replay.h"
+#include "include/ai/Strategy.h"
+#include "include/ai/HandBuckets.h"
 #include <iostream>
 #include <ctime>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
+
+// BloodGamble                                    interactive game
+// BloodGamble --simulate [--hands N] [--seed S]  headless AI-vs-AI simulation
+// BloodGamble --tournament [--games N] [--threads T] [--seed S]
+//                                                full games on every core
+// BloodGamble --replay FILE [--game G] [--round R]
+//                                                rebuild a logged game, print one round
+// --log FILE appends a binary hand history of the interactive game or simulation
+// --seats N (2-10) and --humans 0,2 | none set up the table; seat 0 is human by default
+// --strategy FILE maps a CfrTrainer strategy table for every AI seat
+// --buckets FILE maps the BucketGen hand buckets that strategy was trained with
+// --mcts MS seats MctsPolicy with an MS millisecond deadline in every AI seat,
+// or in the seats of --mcts-seats LIST (which alone keeps the default deadline)
+
+namespace {
+
+// Comma-separated seat numbers, or "none"; false on anything else
+bool parseSeats(const std::string& list, uint32_t& mask) {
+    mask = 0;
+    if (list == "none") return true;
+    size_t pos = 0;
+    while (pos <= list.size()) {
+        size_t comma = std::min(list.find(',', pos), list.size());
+        std::string item = list.substr(pos, comma - pos);
+        if (item.empty() || item.find_first_not_of("0123456789") != std::string::npos) return false;
+        int seat = std::atoi(item.c_str());
+        if (seat >= MAX_SEATS) return false;
+        mask |= seatBit(seat);
+        pos = comma + 1;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bool simulate = false;
+    bool tournament = false;
+    uint64_t hands = 1000000;
+    uint64_t games = 10000;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t seed = 0;
+    std::string logPath;
+    std::string replayPath;
+    std::string strategyPath;
+    std::string bucketsPath;
+    int replayGame = 0;
+    int replayRound = -1;
+    TableSetup table;
+    bool tableValid = true;
+    bool mctsSeatsGiven = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--simulate") {
+            simulate = true;
+        } else if (arg == "--tournament") {
+            tournament = true;
+        } else if (arg == "--games" && i + 1 < argc) {
+            games = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (arg == "--hands" && i + 1 < argc) {
+            hands = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--log" && i + 1 < argc) {
+            logPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (arg == "--game" && i + 1 < argc) {
+            replayGame = std::atoi(argv[++i]);
+        } else if (arg == "--round" && i + 1 < argc) {
+            replayRound = std::atoi(argv[++i]);
+        } else if (arg == "--seats" && i + 1 < argc) {
+            table.seats = std::atoi(argv[++i]);
+        } else if (arg == "--humans" && i + 1 < argc) {
+            tableValid = parseSeats(argv[++i], table.humanMask) && tableValid;
+        } else if (arg == "--strategy" && i + 1 < argc) {
+            strategyPath = argv[++i];
+        } else if (arg == "--buckets" && i + 1 < argc) {
+            bucketsPath = argv[++i];
+        } else if (arg == "--mcts" && i + 1 < argc) {
+            double milliseconds = std::atof(argv[++i]);
+            table.mctsBudgetUs = static_cast<int>(milliseconds * 1000);
+            tableValid = table.mctsBudgetUs > 0 && tableValid;
+            if (!mctsSeatsGiven) table.mctsMask = ~0u;
+        } else if (arg == "--mcts-seats" && i + 1 < argc) {
+            tableValid = parseSeats(argv[++i], table.mctsMask) && tableValid;
+            mctsSeatsGiven = true;
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--simulate [--hands N] | --tournament [--games N] [--threads T]]"
+                      << " [--seed S] [--log FILE] [--seats N] [--humans LIST] [--strategy FILE [--buckets FILE]]"
+                      << " [--mcts MS] [--mcts-seats LIST]\n"
+                      << "       " << argv[0] << " --replay FILE [--game G] [--round R]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!tableValid || table.seats < MIN_SEATS || table.seats > MAX_SEATS
+        || (table.humanMask >> table.seats) != 0 || (mctsSeatsGiven && (table.mctsMask >> table.seats) != 0)) {
+        std::cerr << "Tables have " << MIN_SEATS << "-" << MAX_SEATS
+                  << " seats; --humans and --mcts-seats list seat numbers below --seats, or none;"
+                  << " --mcts takes a positive deadline in milliseconds\n";
+        return EXIT_FAILURE;
+    }
+    if (!mctsSeatsGiven) table.mctsMask &= ~table.humanMask & ((1u << table.seats) - 1);
+
+    std::string loadError;
+    if (!strategyPath.empty() && !StrategyTable::global().load(strategyPath, loadError)) {
+        std::cerr << "Cannot load strategy: " << loadError << "\n";
+        return EXIT_FAILURE;
+    }
+    if (!bucketsPath.empty() && !BucketTable::global().load(bucketsPath, loadError)) {
+        std::cerr << "Cannot load buckets: " << loadError << "\n";
+        return EXIT_FAILURE;
+    }
+    if (StrategyTable::global().loaded() && StrategyTable::global().bucketTable() != BucketTable::global().id()) {
+        std::cerr << (StrategyTable::global().bucketTable() ? "The strategy needs the --buckets table it was trained with\n"
+                                                            : "The strategy was trained without --buckets\n");
+        return EXIT_FAILURE;
+    }
+
+    if (!replayPath.empty()) {
+        HandHistory log;
+        if (!log.openReplay(replayPath)) {
+            std::cerr << "Cannot read hand history " << replayPath << "\n";
+            return EXIT_FAILURE;
+        }
+        ReplayResult result = Replay::run(log, replayGame, replayRound, std::cout);
+        std::cout << "Replayed " << result.games << " games, " << result.rounds << " rounds, "
+                  << result.records << " records: ";
+        if (result.mismatches == 0) {
+            std::cout << "identical\n";
+            return 0;
+        }
+        std::cout << result.mismatches << " mismatches, first at record " << result.firstMismatch << "\n";
+        return EXIT_FAILURE;
+    }
+
+    HandHistory history;
+    // Simulations keep the large write buffer; other games reach the file after every round
+    if (!logPath.empty() && !history.openWrite(logPath, simulate)) {
+        std::cerr << "Cannot write hand history " << logPath << " (it must be new or a version " << HISTORY_VERSION << " log)\n";
+        return EXIT_FAILURE;
+    }
+    HandHistory* log = logPath.empty() ? nullptr : &history;
+
+    if (simulate) {
+        if (seed == 0) seed = std::time(nullptr);
+        Simulator::report(Simulator::run(hands, seed, log, table), std::cout);
+        return 0;
+    }
+
+    if (tournament) {
+        TournamentRunner::Settings settings;
+        settings.games = games;
+        settings.masterSeed = seed == 0 ? std::time(nullptr) : seed;
+        settings.threads = threads;
+        settings.table = table;
+        TournamentRunner::report(TournamentRunner::run(settings), std::cout);
+        return 0;
+    }
+
+    if (seed == 0) {
+        std::cout << "Enter seed (0 for random): ";
+        std::cin >> seed;
+    }
 
-int main() {
-    std::cout << "Enter seed (0 for random): ";
-    unsigned int seed;
-    std::cin >> seed;
-    
     if (seed == 0) {
         seed = std::time(nullptr);
     }
-    
-    BloodGambleGame game(seed);
+
+    BloodGambleGame game(seed, false, table);
+    if (log) game.setHistory(log);
     game.run();
-    
+
     return 0;
-}
\ No newline at end of file
+}
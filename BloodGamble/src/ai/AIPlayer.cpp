@@ -1,34 +1,173 @@
 #include "../../include/ai/AIPlayer.h"
+#include "../../include/ai/EquityEngine.h"
+#include "../../include/ai/EquityEnumerator.h"
+#include "../../include/ai/HandBuckets.h"
+#include "../../include/ai/PreflopTable.h"
+#include "../../include/ai/Strategy.h"
 #include "../../include/core/Card.h"
+#include "../../include/core/HandEvaluator.h"
 #include <algorithm>
+#include <thread>
+
+namespace {
+
+// Same game, round, seat and street always sample the same runouts
+uint64_t decisionSeed(const GameState& game, const Player& ai) {
+    return splitMix64(game.seed) ^ (static_cast<uint64_t>(game.roundNumber) << 8)
+         ^ (static_cast<uint64_t>(ai.id) << 4) ^ static_cast<uint64_t>(game.board.size());
+}
+
+// Opponents still contesting the pot
+int countOpponents(const Player& ai, const GameState& game) {
+    int opponents = 0;
+    for (const auto& player : game.players) {
+        if (player.id != ai.id && !player.folded && (player.hp > 0 || player.allIn)) {
+            opponents++;
+        }
+    }
+    return opponents;
+}
+
+// Relative to the fair share 1/(opponents+1), so 0.5 means an average hand at any table size
+double strengthFromEquity(double equity, int opponents) {
+    return std::clamp(equity * (opponents + 1) / 2.0, 0.0, 1.0);
+}
+
+} // namespace
 
 PlayerAction AIPlayer::decideAction(Player& ai, const GameState& game, int callAmount, int minRaise) {
     if (ai.hp <= 0 || ai.folded) return PlayerAction::FOLD;
+    return decideFromStrength(ai, estimateStrength(ai, game), callAmount, minRaise, readOpponents(ai, game));
+}
+
+OpponentRead AIPlayer::readOpponents(const Player& ai, const GameState& game) {
+    OpponentRead read;
+    int opponents = 0;
+    for (uint32_t rest = game.inHandMask & ~seatBit(ai.id); rest; rest &= rest - 1) {
+        OpponentProfile profile = game.players[nextSeat(rest, 0)].stats.read();
+        double aggression = profile.aggressionFactor() / (1.0 + profile.aggressionFactor())
+                          - OpponentProfile::PRIOR_AGGRESSION_FACTOR / (1.0 + OpponentProfile::PRIOR_AGGRESSION_FACTOR);
+        read.callShift += 0.2 * aggression + 0.15 * (profile.vpip() - OpponentProfile::PRIOR_VPIP)
+                        + 0.05 * std::min(1.0, profile.cheatsDetected());
+        read.raiseShift += 0.2 * (profile.foldToRaise() - OpponentProfile::PRIOR_FOLD_TO_RAISE)
+                         + 0.1 * (profile.showdownRate() - OpponentProfile::PRIOR_SHOWDOWN);
+        opponents++;
+    }
+    if (opponents > 0) {
+        read.callShift = std::clamp(read.callShift / opponents, -AI_OPPONENT_MAX_SHIFT, AI_OPPONENT_MAX_SHIFT);
+        read.raiseShift = std::clamp(read.raiseShift / opponents, -AI_OPPONENT_MAX_SHIFT, AI_OPPONENT_MAX_SHIFT);
+    }
+    return read;
+}
+
+double AIPlayer::estimateStrength(const Player& ai, const GameState& game, EquityBudget budget) {
+    int opponents = countOpponents(ai, game);
+    if (ai.handMask.size() != 2 || opponents == 0) return 0.5; // Default average
     
-    // Calculate hand strength (simplified)
-    std::vector<Card> allCards = ai.hand;
-    allCards.insert(allCards.end(), game.board.begin(), game.board.end());
+    // Preflop equity is precomputed; few unknown cards left (turn/river heads-up) are
+    // cheaper to enumerate exactly than to sample
+    if (game.board.empty()) {
+        return strengthFromEquity(preflopEquity(ai.hand[0], ai.hand[1], opponents), opponents);
+    }
     
-    double handStrength = 0.5; // Default average
-    if (allCards.size() >= 2) {
-        // Simple hand strength based on hole cards
-        bool isPair = ai.hand[0].rank == ai.hand[1].rank;
-        bool isHighCard = ai.hand[0].rank >= Rank::TEN || ai.hand[1].rank >= Rank::TEN;
-        bool isSuited = ai.hand[0].suit == ai.hand[1].suit;
-        
-        if (isPair) handStrength = 0.8;
-        else if (isHighCard && isSuited) handStrength = 0.7;
-        else if (isHighCard) handStrength = 0.6;
-        else if (isSuited) handStrength = 0.55;
+    const bool timed = budget == EquityBudget::TIMED;
+    int threads = timed ? static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) : 1;
+    std::vector<CardSet> holes(opponents + 1);
+    holes[0] = ai.handMask;
+    if (EquityEnumerator::dealCount(holes, game.boardMask) <= AI_EXACT_EQUITY_MAX_DEALS) {
+        return strengthFromEquity(EquityEnumerator::enumerate(holes, game.boardMask, threads).equity(0), opponents);
     }
     
+    EquityEngine::Settings settings;
+    settings.threads = threads;
+    settings.seed = decisionSeed(game, ai);
+    if (timed) {
+        settings.targetError = AI_EQUITY_TARGET_ERROR;
+        settings.timeBudget = std::chrono::microseconds(AI_EQUITY_BUDGET_US);
+    } else {
+        settings.maxSamples = AI_EQUITY_FIXED_SAMPLES;
+        settings.targetError = 0.0;   // Run every sample; only a certain result stops sooner
+    }
+    return strengthFromEquity(EquityEngine::estimate(ai.handMask, game.boardMask, opponents, settings).equity, opponents);
+}
+
+double AIPlayer::quickStrength(const Player& ai, const GameState& game) {
+    return quickStrength(ai.handMask, game.boardMask, countOpponents(ai, game));
+}
+
+double AIPlayer::quickStrength(CardSet hole, CardSet board, int opponents) {
+    if (hole.size() != 2 || opponents == 0) return 0.5;
+    
+    if (board.empty()) {
+        Card first = hole.popLowest();
+        return strengthFromEquity(preflopEquity(first, hole.popLowest(), opponents), opponents);
+    }
+    
+    // Postflop: made hand category, discounted when the board alone already makes it
+    static const double MADE_HAND_STRENGTH[] = {0.3, 0.55, 0.7, 0.8, 0.85, 0.88, 0.93, 0.97, 1.0, 1.0};
+    uint32_t hand = HandEvaluator::evaluate(hole | board);
+    HandRank rank = HandEvaluator::rankOf(hand);
+    double strength = MADE_HAND_STRENGTH[static_cast<int>(rank)];
+    if (rank == HandEvaluator::rankOf(HandEvaluator::evaluate(board))) {
+        strength *= 0.6;
+    }
+    return strength;
+}
+
+int AIPlayer::strengthBucket(CardSet hole, CardSet board, int opponents) {
+    const BucketTable& buckets = BucketTable::global();
+    if (buckets.loaded() && hole.size() == 2 && board.size() >= HandIndexer::MIN_BOARD_CARDS) {
+        return buckets.bucket(hole, board);
+    }
+    return strategyBucket(quickStrength(hole, board, opponents));
+}
+
+bool AIPlayer::decideFromStrategy(const Player& ai, const GameState& game, int callAmount,
+                                  PlayerAction& action, int& raiseAmount) {
+    const StrategyTable& table = StrategyTable::global();
+    if (!table.loaded()) return false;
+    
+    int bucket = strengthBucket(ai.handMask, game.boardMask, countOpponents(ai, game));
+    int position = ai.id == game.smallBlindIndex ? 0 : 1;
+    const uint8_t* weights = table.row(strategyIndex(strategyStreet(static_cast<int>(game.board.size())),
+                                                     bucket, position, strategyCallClass(callAmount),
+                                                     strategyPotClass(game.pot)));
+    
+    // A hash of the spot picks the action, so decisions stay reproducible and no game stream is used
+    uint64_t spot = splitMix64(decisionSeed(game, ai) ^ (static_cast<uint64_t>(game.pot) << 40)
+                               ^ (static_cast<uint64_t>(callAmount) << 24));
+    int pick = static_cast<int>(spot % 255);
+    int chosen = -1;
+    for (int a = 0, total = 0; a < STRATEGY_ACTIONS; a++) {
+        total += weights[a];
+        if (pick < total) {
+            chosen = a;
+            break;
+        }
+    }
+    if (chosen < 0) return false;   // Untrained spot
+    
+    raiseAmount = 0;
+    switch (static_cast<StrategyAction>(chosen)) {
+        case StrategyAction::FOLD: action = callAmount > 0 ? PlayerAction::FOLD : PlayerAction::CALL; break;
+        case StrategyAction::CALL: action = PlayerAction::CALL; break;
+        case StrategyAction::RAISE_MIN: action = PlayerAction::RAISE; raiseAmount = MIN_BET; break;
+        case StrategyAction::RAISE_MAX: action = PlayerAction::RAISE; raiseAmount = MAX_BET; break;
+        default: action = PlayerAction::ALL_IN; break;
+    }
+    if (action == PlayerAction::RAISE && ai.hp <= callAmount + raiseAmount) action = PlayerAction::ALL_IN;
+    return true;
+}
+
+PlayerAction AIPlayer::decideFromStrength(const Player& ai, double handStrength, int callAmount, int minRaise,
+                                          const OpponentRead& read) {
     // Adjust for AI personality and suspicion
     double effectiveAggression = ai.aggression * (1.0 - 0.5 * ai.suspicion);
     double effectiveTightness = ai.tightness * (1.0 + 0.3 * ai.suspicion);
     
-    // Decision logic
-    double foldThreshold = effectiveTightness * 0.8;
-    double raiseThreshold = 0.7 + (1.0 - effectiveAggression) * 0.2;
+    // Decision logic, shifted by how the opponents have been playing
+    double foldThreshold = effectiveTightness * 0.8 - read.callShift;
+    double raiseThreshold = 0.7 + (1.0 - effectiveAggression) * 0.2 - read.raiseShift;
     
     if (handStrength < foldThreshold) {
         return PlayerAction::FOLD;
@@ -0,0 +1,153 @@
+#include "../../include/ai/EquityEngine.h"
+#include "../../include/core/HandEvaluator.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+const uint64_t BLOCK_SAMPLES = 256;
+const uint64_t CHECKPOINT_BLOCKS = 4;   // Stopping rule is tested every 1024 samples
+
+struct BlockResult {
+    double sum = 0.0;
+    double sumSquares = 0.0;
+};
+
+struct Setup {
+    CardSet hole;
+    CardSet board;
+    int opponents;
+    int missingBoard;
+    uint8_t available[52];
+    uint32_t availableCount;
+};
+
+BlockResult runBlock(const Setup& setup, uint64_t seed, uint64_t block) {
+    Rng rng(splitMix64(seed ^ splitMix64(block)));
+    uint8_t cards[52];
+    std::copy(setup.available, setup.available + setup.availableCount, cards);
+
+    BlockResult result;
+    for (uint64_t sample = 0; sample < BLOCK_SAMPLES; sample++) {
+        // Partial Fisher-Yates: only the cards this runout needs are shuffled into place
+        uint32_t drawn = 0;
+        auto next = [&]() {
+            uint32_t pick = drawn + bounded(rng, setup.availableCount - drawn);
+            std::swap(cards[drawn], cards[pick]);
+            return Card::fromIndex(cards[drawn++]);
+        };
+
+        CardSet runout = setup.board;
+        for (int i = 0; i < setup.missingBoard; i++) {
+            runout.add(next());
+        }
+
+        uint32_t hero = HandEvaluator::evaluate(setup.hole | runout);
+        uint32_t bestOpponent = 0;
+        int tiedOpponents = 0;
+        for (int opp = 0; opp < setup.opponents; opp++) {
+            CardSet hand = runout;
+            hand.add(next());
+            hand.add(next());
+            uint32_t strength = HandEvaluator::evaluate(hand);
+            if (strength > bestOpponent) {
+                bestOpponent = strength;
+                tiedOpponents = 1;
+            } else if (strength == bestOpponent) {
+                tiedOpponents++;
+            }
+        }
+
+        double share = 0.0;
+        if (hero > bestOpponent) share = 1.0;
+        else if (hero == bestOpponent) share = 1.0 / (tiedOpponents + 1);
+        result.sum += share;
+        result.sumSquares += share * share;
+    }
+    return result;
+}
+
+EquityResult summarize(double sum, double sumSquares, uint64_t samples) {
+    double mean = sum / samples;
+    double variance = std::max(0.0, sumSquares / samples - mean * mean);
+    return {mean, std::sqrt(variance / samples), samples};
+}
+
+} // namespace
+
+EquityResult EquityEngine::estimate(CardSet hole, CardSet board, int opponents,
+                                    const Settings& settings, CardSet dead) {
+    if (opponents <= 0) return {1.0, 0.0, 0};
+
+    Setup setup;
+    setup.hole = hole;
+    setup.board = board;
+    setup.opponents = opponents;
+    setup.missingBoard = std::max(0, 5 - board.size());
+    setup.availableCount = 0;
+    CardSet available = CardSet::fullDeck() - hole - board - dead;
+    while (!available.empty()) {
+        setup.available[setup.availableCount++] = available.popLowest().index();
+    }
+    if (static_cast<uint32_t>(setup.missingBoard + 2 * opponents) > setup.availableCount) {
+        throw std::runtime_error("Not enough cards left for equity simulation!");
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const bool hasDeadline = settings.timeBudget.count() > 0;
+    const Clock::time_point deadline = Clock::now() + settings.timeBudget;
+
+    const uint64_t totalBlocks = std::max<uint64_t>(1, (settings.maxSamples + BLOCK_SAMPLES - 1) / BLOCK_SAMPLES);
+    std::vector<BlockResult> results(totalBlocks);
+    std::unique_ptr<std::atomic<bool>[]> done(new std::atomic<bool>[totalBlocks]);
+    for (uint64_t i = 0; i < totalBlocks; i++) done[i].store(false, std::memory_order_relaxed);
+    std::atomic<uint64_t> nextBlock{0};
+    std::atomic<bool> stop{false};
+
+    // Only the calling thread folds finished blocks into the prefix and tests the stopping rule
+    uint64_t prefix = 0;
+    double sum = 0.0, sumSquares = 0.0;
+    bool settled = false;
+    auto advancePrefix = [&]() {
+        while (!settled && prefix < totalBlocks && done[prefix].load(std::memory_order_acquire)) {
+            sum += results[prefix].sum;
+            sumSquares += results[prefix].sumSquares;
+            prefix++;
+            if (prefix % CHECKPOINT_BLOCKS == 0 || prefix == totalBlocks) {
+                EquityResult current = summarize(sum, sumSquares, prefix * BLOCK_SAMPLES);
+                if (current.standardError <= settings.targetError || prefix == totalBlocks) {
+                    settled = true;
+                    stop.store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    auto work = [&](bool caller) {
+        while (!stop.load(std::memory_order_relaxed)) {
+            uint64_t block = nextBlock.fetch_add(1, std::memory_order_relaxed);
+            if (block >= totalBlocks) break;
+            results[block] = runBlock(setup, settings.seed, block);
+            done[block].store(true, std::memory_order_release);
+            if (caller) advancePrefix();
+            if (hasDeadline && Clock::now() >= deadline) stop.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < settings.threads; i++) {
+        workers.emplace_back(work, false);
+    }
+    work(true);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    advancePrefix();
+
+    return summarize(sum, sumSquares, prefix * BLOCK_SAMPLES);
+}
@@ -0,0 +1,228 @@
+#include "../../include/ai/EquityEnumerator.h"
+#include "../../include/core/HandEvaluator.h"
+#include <atomic>
+#include <thread>
+#include <stdexcept>
+#include <functional>
+#include <algorithm>
+
+namespace {
+
+const int MAX_ENUM_SEATS = 10;
+const int MAX_SLOTS = 5 + 2 * MAX_ENUM_SEATS;
+
+struct Slot {
+    int seat;           // -1 for a board card
+    bool startsGroup;   // First card of the board run or of a seat's hole pair
+};
+
+struct Plan {
+    int seats = 0;
+    std::vector<Slot> slots;
+    std::vector<uint8_t> available;
+    CardSet known[MAX_ENUM_SEATS];  // Hole cards plus the known board, per seat
+};
+
+Plan makePlan(const std::vector<CardSet>& holes, CardSet board, CardSet dead) {
+    if (holes.size() < 2 || holes.size() > MAX_ENUM_SEATS) {
+        throw std::runtime_error("Exact equity needs between 2 and 10 seats!");
+    }
+
+    Plan plan;
+    plan.seats = static_cast<int>(holes.size());
+    CardSet used = board | dead;
+    for (int seat = 0; seat < plan.seats; seat++) {
+        plan.known[seat] = holes[seat] | board;
+        used |= holes[seat];
+    }
+
+    int missingBoard = 5 - board.size();
+    for (int i = 0; i < missingBoard; i++) {
+        plan.slots.push_back({-1, i == 0});
+    }
+    for (int seat = 0; seat < plan.seats; seat++) {
+        if (holes[seat].empty()) {
+            plan.slots.push_back({seat, true});
+            plan.slots.push_back({seat, false});
+        }
+    }
+
+    CardSet available = CardSet::fullDeck() - used;
+    while (!available.empty()) {
+        plan.available.push_back(available.popLowest().index());
+    }
+    if (plan.slots.size() > plan.available.size()) {
+        throw std::runtime_error("Not enough cards left for exact equity!");
+    }
+    return plan;
+}
+
+class Walker {
+public:
+    explicit Walker(const Plan& p) : plan(p), outcomes(p.seats) {
+        for (int seat = 0; seat < plan.seats; seat++) {
+            masks[0][seat] = plan.known[seat];
+        }
+    }
+
+    // Every deal whose first enumerated card is available[pos]
+    void visitFirst(size_t pos) {
+        place(0, pos);
+    }
+
+    void visitAll() {
+        visit(0, 0);
+    }
+
+    const Plan& plan;
+    std::vector<SeatOutcome> outcomes;
+    uint64_t deals = 0;
+
+private:
+    CardSet masks[MAX_SLOTS + 1][MAX_ENUM_SEATS];
+    CardSet used;
+
+    void visit(size_t depth, size_t start) {
+        if (depth == plan.slots.size()) {
+            score(masks[depth]);
+            return;
+        }
+        if (plan.slots[depth].startsGroup) start = 0;
+        for (size_t pos = start; pos < plan.available.size(); pos++) {
+            place(depth, pos);
+        }
+    }
+
+    // Deals available[pos] into slot `depth`, extending the hands built so far
+    void place(size_t depth, size_t pos) {
+        Card card = Card::fromIndex(plan.available[pos]);
+        if (used.contains(card)) return;
+
+        const CardSet* from = masks[depth];
+        CardSet* to = masks[depth + 1];
+        int seat = plan.slots[depth].seat;
+        if (seat < 0) {
+            for (int s = 0; s < plan.seats; s++) to[s] = from[s] | card;
+        } else {
+            for (int s = 0; s < plan.seats; s++) to[s] = from[s];
+            to[seat].add(card);
+        }
+
+        used.add(card);
+        visit(depth + 1, pos + 1);
+        used.remove(card);
+    }
+
+    void score(const CardSet* hands) {
+        uint32_t strengths[MAX_ENUM_SEATS];
+        uint32_t best = 0;
+        int atBest = 0;
+        for (int s = 0; s < plan.seats; s++) {
+            strengths[s] = HandEvaluator::evaluate(hands[s]);
+            if (strengths[s] > best) {
+                best = strengths[s];
+                atBest = 1;
+            } else if (strengths[s] == best) {
+                atBest++;
+            }
+        }
+
+        for (int s = 0; s < plan.seats; s++) {
+            SeatOutcome& outcome = outcomes[s];
+            if (strengths[s] != best) {
+                outcome.losses++;
+            } else {
+                if (atBest == 1) outcome.wins++;
+                else outcome.ties++;
+                outcome.shareUnits += POT_SHARE_UNITS / atBest;
+            }
+        }
+        deals++;
+    }
+};
+
+uint64_t choose(uint64_t n, uint64_t k) {
+    if (k > n) return 0;
+    uint64_t result = 1;
+    for (uint64_t i = 1; i <= k; i++) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+} // namespace
+
+double ExactEquity::equity(int seat) const {
+    if (deals == 0) return 0.0;
+    return static_cast<double>(seats[seat].shareUnits) / (static_cast<double>(POT_SHARE_UNITS) * deals);
+}
+
+uint64_t EquityEnumerator::dealCount(const std::vector<CardSet>& holes, CardSet board, CardSet dead) {
+    CardSet used = board | dead;
+    int unknownSeats = 0;
+    for (const auto& hole : holes) {
+        used |= hole;
+        if (hole.empty()) unknownSeats++;
+    }
+
+    uint64_t remaining = 52 - used.size();
+    uint64_t missingBoard = 5 - board.size();
+    uint64_t deals = choose(remaining, missingBoard);
+    remaining -= missingBoard;
+    for (int i = 0; i < unknownSeats; i++, remaining -= 2) {
+        uint64_t hands = choose(remaining, 2);
+        if (hands != 0 && deals > UINT64_MAX / hands) return UINT64_MAX;   // Far past anything enumerable
+        deals *= hands;
+    }
+    return deals;
+}
+
+ExactEquity EquityEnumerator::enumerate(const std::vector<CardSet>& holes, CardSet board, int threads, CardSet dead) {
+    Plan plan = makePlan(holes, board, dead);
+
+    ExactEquity result;
+    result.seats.resize(plan.seats);
+
+    if (plan.slots.empty()) {
+        Walker walker(plan);
+        walker.visitAll();
+        result.seats = walker.outcomes;
+        result.deals = walker.deals;
+        return result;
+    }
+
+    // Threads take first-card positions from a shared counter and merge their counts at the end
+    std::atomic<size_t> nextFirst{0};
+    std::vector<Walker> walkers;
+    walkers.reserve(std::max(1, threads));
+    for (int i = 0; i < std::max(1, threads); i++) {
+        walkers.emplace_back(plan);
+    }
+
+    auto work = [&](Walker& walker) {
+        size_t pos;
+        while ((pos = nextFirst.fetch_add(1, std::memory_order_relaxed)) < plan.available.size()) {
+            walker.visitFirst(pos);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < walkers.size(); i++) {
+        workers.emplace_back(work, std::ref(walkers[i]));
+    }
+    work(walkers[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& walker : walkers) {
+        for (int s = 0; s < plan.seats; s++) {
+            result.seats[s].wins += walker.outcomes[s].wins;
+            result.seats[s].ties += walker.outcomes[s].ties;
+            result.seats[s].losses += walker.outcomes[s].losses;
+            result.seats[s].shareUnits += walker.outcomes[s].shareUnits;
+        }
+        result.deals += walker.deals;
+    }
+    return result;
+}
@@ -0,0 +1,52 @@
+#include "../../include/ai/HandBuckets.h"
+#include "../../include/ai/Strategy.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+bool BucketTable::load(const std::string& path, std::string& error) {
+    std::fill(std::begin(streets), std::end(streets), nullptr);
+    tableId = 0;
+    if (!file.open(path)) {
+        error = "cannot map " + path;
+        return false;
+    }
+
+    BucketFileHeader header;
+    if (file.size() < sizeof(header)) {
+        error = path + " is too short";
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, BUCKET_MAGIC, sizeof(header.magic)) != 0 || header.version != BUCKET_VERSION) {
+        error = path + " is not a version " + std::to_string(BUCKET_VERSION) + " bucket table";
+        return false;
+    }
+    size_t expected = sizeof(header);
+    for (int street = 0; street < BUCKET_STREETS; street++) {
+        expected += HandIndexer::size(street + HandIndexer::MIN_BOARD_CARDS);
+    }
+    if (header.streets != BUCKET_STREETS || header.buckets != STRATEGY_BUCKETS || file.size() != expected) {
+        error = path + " does not match this build's hand index and bucket count";
+        return false;
+    }
+    for (int street = 0; street < BUCKET_STREETS; street++) {
+        if (header.classes[street] != HandIndexer::size(street + HandIndexer::MIN_BOARD_CARDS)) {
+            error = path + " does not match this build's hand index and bucket count";
+            return false;
+        }
+    }
+
+    const uint8_t* buckets = file.data() + sizeof(header);
+    for (int street = 0; street < BUCKET_STREETS; street++) {
+        streets[street] = buckets;
+        buckets += header.classes[street];
+    }
+    tableId = header.id;
+    return true;
+}
+
+BucketTable& BucketTable::global() {
+    static BucketTable table;
+    return table;
+}
@@ -0,0 +1,261 @@
+#include "../../include/ai/HandIndexer.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+const int RANKS = 13;
+const int SUITS = 4;
+const int BOARD_SHAPES = HandIndexer::MAX_BOARD_CARDS + 1;
+const int SHAPES = 3 * BOARD_SHAPES;   // Hole cards 0-2 by board cards 0-5 within one suit
+
+// Multisets here hold at most one number per suit, so k <= 4 and the divisors are constants
+uint64_t choose(uint64_t n, int k) {
+    if (k < 0 || static_cast<uint64_t>(k) > n) return 0;
+    switch (k) {
+        case 0: return 1;
+        case 1: return n;
+        case 2: return n * (n - 1) / 2;
+        case 3: return n * (n - 1) * (n - 2) / 6;
+        default: return n * (n - 1) * (n - 2) * (n - 3) / 24;
+    }
+}
+
+// Pascal's triangle over the ranks of one suit, for the per-suit numbers
+struct RankBinomials {
+    uint32_t value[RANKS + 1][RANKS + 1] = {};
+
+    constexpr RankBinomials() {
+        for (int n = 0; n <= RANKS; n++) {
+            value[n][0] = 1;
+            for (int k = 1; k <= n; k++) value[n][k] = value[n - 1][k - 1] + (k < n ? value[n - 1][k] : 0);
+        }
+    }
+};
+constexpr RankBinomials RANK_CHOOSE;
+
+int holeCardsOf(int shape) { return shape / BOARD_SHAPES; }
+int boardCardsOf(int shape) { return shape % BOARD_SHAPES; }
+
+// Distinct (hole ranks, board ranks) pairs a suit of this shape can hold
+uint32_t suitNumbers(int shape) {
+    int hole = holeCardsOf(shape);
+    return RANK_CHOOSE.value[RANKS][hole] * RANK_CHOOSE.value[RANKS - hole][boardCardsOf(shape)];
+}
+
+// Colexicographic rank of a rank mask among masks with as many bits
+uint32_t colexRank(uint32_t mask) {
+    uint32_t rank = 0;
+    for (int bit = 1; mask; bit++, mask &= mask - 1) {
+        rank += RANK_CHOOSE.value[CardSet(mask).lowestIndex()][bit];
+    }
+    return rank;
+}
+
+uint32_t colexUnrank(uint32_t rank, int bits) {
+    uint32_t mask = 0;
+    for (int position = RANKS - 1; bits > 0; position--) {
+        uint32_t below = RANK_CHOOSE.value[position][bits];
+        if (below <= rank) {
+            mask |= 1u << position;
+            rank -= below;
+            bits--;
+        }
+    }
+    return mask;
+}
+
+// Drops the rank positions taken by the hole cards, so board masks number densely
+uint32_t squeeze(uint32_t mask, uint32_t taken) {
+    for (int removed = 0; taken; taken &= taken - 1, removed++) {
+        int position = CardSet(taken).lowestIndex() - removed;
+        mask = (mask & ((1u << position) - 1)) | ((mask >> (position + 1)) << position);
+    }
+    return mask;
+}
+
+uint32_t expand(uint32_t mask, uint32_t taken) {
+    for (; taken; taken &= taken - 1) {
+        int position = CardSet(taken).lowestIndex();
+        mask = (mask & ((1u << position) - 1)) | ((mask >> position) << (position + 1));
+    }
+    return mask;
+}
+
+struct SuitKey {
+    int shape;
+    uint32_t number;
+
+    // Shape first, then number, as one integer comparison
+    uint64_t order() const { return static_cast<uint64_t>(shape) << 32 | number; }
+    bool operator>(const SuitKey& other) const { return order() > other.order(); }
+    bool operator==(const SuitKey& other) const { return shape == other.shape && number == other.number; }
+};
+
+// Per-suit keys in canonical (descending) order
+void canonicalSuits(CardSet hole, CardSet board, SuitKey* keys) {
+    for (int suit = 0; suit < SUITS; suit++) {
+        uint32_t holeMask = hole.suitMask(suit);
+        uint32_t boardMask = board.suitMask(suit);
+        int holeCards = CardSet(holeMask).size();
+        int boardCards = CardSet(boardMask).size();
+        SuitKey key = {holeCards * BOARD_SHAPES + boardCards,
+                       colexRank(holeMask) * RANK_CHOOSE.value[RANKS - holeCards][boardCards]
+                           + colexRank(squeeze(boardMask, holeMask))};
+        int slot = suit;
+        for (; slot > 0 && key > keys[slot - 1]; slot--) keys[slot] = keys[slot - 1];
+        keys[slot] = key;
+    }
+}
+
+// Suits sharing a shape within a configuration; their numbers form a multiset
+struct Group {
+    int shape;
+    int count;
+    uint32_t combos;
+};
+
+// One sorted assignment of shapes to the four suits
+struct Config {
+    uint32_t key;       // Shapes in base SHAPES
+    uint32_t offset;    // First index of the configuration
+    int groups;
+    Group group[SUITS];
+};
+
+struct Street {
+    std::vector<Config> configs;   // Ascending key and offset
+    uint32_t size = 0;
+};
+
+struct Tables {
+    Street streets[HandIndexer::MAX_BOARD_CARDS - HandIndexer::MIN_BOARD_CARDS + 1];
+
+    Tables() {
+        for (int boardCards = HandIndexer::MIN_BOARD_CARDS; boardCards <= HandIndexer::MAX_BOARD_CARDS; boardCards++) {
+            Street& street = streets[boardCards - HandIndexer::MIN_BOARD_CARDS];
+            int shapes[SUITS];
+            enumerate(street, shapes, 0, SHAPES - 1, 2, boardCards);
+            std::sort(street.configs.begin(), street.configs.end(),
+                      [](const Config& a, const Config& b) { return a.key < b.key; });
+            for (Config& config : street.configs) {
+                config.offset = street.size;
+                uint32_t size = 1;
+                for (int g = 0; g < config.groups; g++) size *= config.group[g].combos;
+                street.size += size;
+            }
+        }
+    }
+
+    // Non-increasing shapes whose hole and board cards add up
+    void enumerate(Street& street, int* shapes, int suit, int maxShape, int holeLeft, int boardLeft) {
+        if (suit == SUITS) {
+            if (holeLeft != 0 || boardLeft != 0) return;
+            Config config = {};
+            for (int s = 0; s < SUITS; s++) {
+                config.key = config.key * SHAPES + shapes[s];
+                if (s > 0 && shapes[s] == shapes[s - 1]) {
+                    config.group[config.groups - 1].count++;
+                } else {
+                    config.group[config.groups++] = {shapes[s], 1, 0};
+                }
+            }
+            for (int g = 0; g < config.groups; g++) {
+                Group& group = config.group[g];
+                group.combos = static_cast<uint32_t>(choose(suitNumbers(group.shape) + group.count - 1, group.count));
+            }
+            street.configs.push_back(config);
+            return;
+        }
+        for (int shape = maxShape; shape >= 0; shape--) {
+            int holeCards = holeCardsOf(shape);
+            int boardCards = boardCardsOf(shape);
+            if (holeCards > holeLeft || boardCards > boardLeft) continue;
+            shapes[suit] = shape;
+            enumerate(street, shapes, suit + 1, shape, holeLeft - holeCards, boardLeft - boardCards);
+        }
+    }
+};
+
+const Street& street(int boardCards) {
+    static const Tables tables;
+    return tables.streets[boardCards - HandIndexer::MIN_BOARD_CARDS];
+}
+
+} // namespace
+
+uint32_t HandIndexer::size(int boardCards) {
+    return street(boardCards).size;
+}
+
+uint32_t HandIndexer::index(CardSet hole, CardSet board) {
+    SuitKey keys[SUITS];
+    canonicalSuits(hole, board, keys);
+    uint32_t key = 0;
+    for (const SuitKey& suit : keys) key = key * SHAPES + suit.shape;
+
+    const Street& cards = street(board.size());
+    const Config& config = *std::lower_bound(cards.configs.begin(), cards.configs.end(), key,
+                                             [](const Config& c, uint32_t k) { return c.key < k; });
+    // Mixed radix over the groups; within one, numbers descend and rank as a multiset
+    uint32_t local = 0;
+    for (int g = 0, s = 0; g < config.groups; g++) {
+        const Group& group = config.group[g];
+        uint32_t rank = 0;
+        for (int i = 0; i < group.count; i++, s++) {
+            int remaining = group.count - i;
+            rank += static_cast<uint32_t>(choose(keys[s].number + remaining - 1, remaining));
+        }
+        local = local * group.combos + rank;
+    }
+    return config.offset + local;
+}
+
+void HandIndexer::unindex(int boardCards, uint32_t index, CardSet& hole, CardSet& board) {
+    const Street& cards = street(boardCards);
+    const Config& config = *(std::upper_bound(cards.configs.begin(), cards.configs.end(), index,
+                                              [](uint32_t i, const Config& c) { return i < c.offset; }) - 1);
+    uint32_t ranks[SUITS];
+    uint32_t local = index - config.offset;
+    for (int g = config.groups - 1; g >= 0; g--) {
+        ranks[g] = local % config.group[g].combos;
+        local /= config.group[g].combos;
+    }
+
+    hole = CardSet();
+    board = CardSet();
+    for (int g = 0, suit = 0; g < config.groups; g++) {
+        const Group& group = config.group[g];
+        int holeCards = holeCardsOf(group.shape);
+        int boardCards = boardCardsOf(group.shape);
+        uint32_t boardNumbers = RANK_CHOOSE.value[RANKS - holeCards][boardCards];
+        uint32_t rank = ranks[g];
+        for (int remaining = group.count; remaining > 0; remaining--, suit++) {
+            // Largest c with C(c, remaining) <= rank; the suit's number is c - (remaining - 1)
+            uint64_t low = remaining - 1, high = suitNumbers(group.shape) + remaining - 2;
+            while (low < high) {
+                uint64_t middle = (low + high + 1) / 2;
+                if (choose(middle, remaining) <= rank) low = middle;
+                else high = middle - 1;
+            }
+            rank -= static_cast<uint32_t>(choose(low, remaining));
+            uint32_t number = static_cast<uint32_t>(low) - (remaining - 1);
+            uint32_t holeMask = colexUnrank(number / boardNumbers, holeCards);
+            uint32_t boardMask = expand(colexUnrank(number % boardNumbers, boardCards), holeMask);
+            hole |= CardSet(static_cast<uint64_t>(holeMask) << (suit * 16));
+            board |= CardSet(static_cast<uint64_t>(boardMask) << (suit * 16));
+        }
+    }
+}
+
+int HandIndexer::weight(CardSet hole, CardSet board) {
+    // 24 suit permutations, less those that only swap identical suits
+    SuitKey keys[SUITS];
+    canonicalSuits(hole, board, keys);
+    int weight = 24;
+    for (int s = 1, run = 1; s < SUITS; s++) {
+        run = keys[s] == keys[s - 1] ? run + 1 : 1;
+        weight /= run;
+    }
+    return weight;
+}
@@ -0,0 +1,392 @@
+#include "../../include/ai/Mcts.h"
+#include "../../include/ai/AIPlayer.h"
+#include "../../include/game/GameState.h"
+#include "../../include/core/HandEvaluator.h"
+#include "../../include/core/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+const int BOARD_CARDS_AT[4] = {0, 3, 4, 5};   // Per street, as BloodGambleGame deals them
+const int MAX_ACTIONS = 5;
+
+struct Option {
+    PlayerAction action;
+    int raiseAmount;
+};
+
+// The searching seat's choices; folding with nothing to call is never better than calling
+int searchOptions(const MctsState& state, Option* options) {
+    int seat = state.toAct;
+    int call = state.highBet - state.bet[seat];
+    int stack = state.stack[seat];
+    int count = 0;
+    if (call > 0) options[count++] = {PlayerAction::FOLD, 0};
+    options[count++] = {PlayerAction::CALL, 0};
+    bool anyoneToRaise = (state.inHand & ~state.allIn & ~seatBit(seat)) != 0;
+    if (anyoneToRaise && stack > call) {
+        if (state.raises < MCTS_MAX_RAISES) {
+            if (stack > call + MIN_BET) options[count++] = {PlayerAction::RAISE, MIN_BET};
+            if (stack > call + MAX_BET) options[count++] = {PlayerAction::RAISE, MAX_BET};
+        }
+        options[count++] = {PlayerAction::ALL_IN, 0};
+    }
+    return count;
+}
+
+// Cards of one determinization: every live hand and the board each street will show
+struct Deal {
+    CardSet hole[MAX_SEATS];
+    CardSet board[4];
+};
+
+} // namespace
+
+// ===== BETTING STATE =====
+
+MctsState MctsState::fromGame(const GameState& game, int seat) {
+    MctsState state;
+    state.seats = static_cast<int>(game.players.size());
+    state.street = static_cast<int>(game.stage);
+    state.toAct = seat;
+    state.pot = game.pot;
+    state.highBet = *std::max_element(game.currentBets.begin(), game.currentBets.end());
+    state.smallBlind = game.smallBlindIndex;
+    state.inHand = game.inHandMask;
+    state.allIn = game.allInMask;
+    state.pending = game.pendingMask & ~seatBit(seat);
+    for (int i = 0; i < state.seats; i++) {
+        state.stack[i] = game.players[i].hp;
+        state.bet[i] = game.currentBets[i];
+    }
+    return state;
+}
+
+bool MctsState::samePosition(const MctsState& other) const {
+    if (seats != other.seats || street != other.street || toAct != other.toAct || pot != other.pot
+        || highBet != other.highBet || inHand != other.inHand || allIn != other.allIn || pending != other.pending) {
+        return false;
+    }
+    return std::equal(stack, stack + seats, other.stack) && std::equal(bet, bet + seats, other.bet);
+}
+
+// Same HP movements as BloodGambleGame::applyAction and applyDecision
+void MctsState::apply(PlayerAction action, int raiseAmount) {
+    int seat = toAct;
+    int call = highBet - bet[seat];
+    int amount = 0;
+    switch (action) {
+        case PlayerAction::FOLD: inHand &= ~seatBit(seat); break;
+        case PlayerAction::CALL: amount = call; break;
+        case PlayerAction::RAISE: amount = call + raiseAmount; break;
+        default: amount = stack[seat]; break;
+    }
+    amount = std::min(amount, stack[seat]);
+    stack[seat] -= amount;
+    bet[seat] += amount;
+    pot += amount;
+    if ((inHand & seatBit(seat)) && stack[seat] == 0) allIn |= seatBit(seat);
+
+    bool raised = action == PlayerAction::RAISE || action == PlayerAction::ALL_IN;
+    if (raised && bet[seat] > highBet) {
+        highBet = bet[seat];
+        pending = inHand & ~allIn & ~seatBit(seat);
+        raises++;
+    }
+    advance(seat);
+}
+
+// Next seat of this pass, or the next street's first, or the end of the hand
+void MctsState::advance(int from) {
+    if (seatCount(inHand) <= 1) {
+        toAct = -1;
+        return;
+    }
+    if (pending) {
+        toAct = nextSeat(pending, (from + 1) % seats);
+        pending &= ~seatBit(toAct);
+        return;
+    }
+    // Preflop bets stay on the table into the flop, as in BloodGambleGame::playStages
+    while (street < static_cast<int>(GameStage::RIVER)) {
+        if (street != static_cast<int>(GameStage::PRE_FLOP)) std::fill(bet, bet + seats, 0);
+        street++;
+        highBet = *std::max_element(bet, bet + seats);
+        raises = 0;
+        pending = inHand & ~allIn;
+        if (pending) {
+            toAct = nextSeat(pending, smallBlind);
+            pending &= ~seatBit(toAct);
+            return;
+        }
+    }
+    toAct = -1;   // Showdown
+}
+
+// ===== SEARCH =====
+
+MctsSearch::MctsSearch(size_t poolNodes) : pool(poolNodes), spare(poolNodes) {
+    models.reserve(MAX_SEATS);
+    for (int seat = 0; seat < MAX_SEATS; seat++) {
+        models.emplace_back(seat, false, 0);
+    }
+}
+
+void MctsSearch::reset() {
+    used = 0;
+    chosen = -1;
+}
+
+int32_t MctsSearch::newNode(int32_t parent, int seat, PlayerAction action, int raiseAmount) {
+    if (used == pool.size()) return -1;
+    int32_t index = static_cast<int32_t>(used++);
+    MctsNode& node = pool[index];
+    node = MctsNode();
+    node.seat = static_cast<uint8_t>(seat);
+    node.action = static_cast<uint8_t>(action);
+    node.raiseAmount = static_cast<int16_t>(raiseAmount);
+    if (parent >= 0) {
+        node.nextSibling = pool[parent].firstChild;
+        pool[parent].firstChild = index;
+    }
+    return index;
+}
+
+int32_t MctsSearch::findChild(int32_t parent, PlayerAction action, int raiseAmount) const {
+    for (int32_t child = pool[parent].firstChild; child >= 0; child = pool[child].nextSibling) {
+        if (pool[child].action == static_cast<uint8_t>(action) && pool[child].raiseAmount == raiseAmount) return child;
+    }
+    return -1;
+}
+
+// Below `node` (whose position is `state`), through opponents' actions only
+int32_t MctsSearch::findPosition(int32_t node, const MctsState& state, const MctsState& target, int depth,
+                                 MctsState& match) const {
+    if (state.samePosition(target)) {
+        match = state;
+        return node;
+    }
+    if (state.over() || state.toAct == searcher || depth >= MCTS_MAX_DEPTH) return -1;
+    for (int32_t child = pool[node].firstChild; child >= 0; child = pool[child].nextSibling) {
+        MctsState next = state;
+        next.apply(static_cast<PlayerAction>(pool[child].action), pool[child].raiseAmount);
+        int32_t found = findPosition(child, next, target, depth + 1, match);
+        if (found >= 0) return found;
+    }
+    return -1;
+}
+
+// Copies the subtree of `node` breadth first into the spare half, which becomes the pool
+int32_t MctsSearch::reroot(int32_t node) {
+    spare[0] = pool[node];
+    spare[0].nextSibling = -1;
+    size_t count = 1;
+    for (size_t scan = 0; scan < count; scan++) {
+        int32_t child = spare[scan].firstChild;
+        int32_t previous = -1;
+        spare[scan].firstChild = child >= 0 ? static_cast<int32_t>(count) : -1;
+        for (; child >= 0; child = pool[child].nextSibling) {
+            spare[count] = pool[child];
+            if (previous >= 0) spare[previous].nextSibling = static_cast<int32_t>(count);
+            previous = static_cast<int32_t>(count++);
+        }
+        if (previous >= 0) spare[previous].nextSibling = -1;
+    }
+    pool.swap(spare);
+    used = count;
+    return 0;
+}
+
+MctsSearch::Result MctsSearch::search(const GameState& game, int seat, const Settings& settings) {
+    auto start = std::chrono::steady_clock::now();
+    MctsState actual = MctsState::fromGame(game, seat);
+    Result result;
+
+    // Re-root below last time's choice while the hand goes on
+    int32_t root = -1;
+    if (chosen >= 0 && seat == searcher && game.roundNumber == roundNumber && game.seed == gameSeed) {
+        MctsState state = rootState;
+        state.apply(static_cast<PlayerAction>(pool[chosen].action), pool[chosen].raiseAmount);
+        MctsState match;
+        int32_t found = findPosition(chosen, state, actual, 0, match);
+        if (found >= 0) {
+            actual.raises = match.raises;   // Not visible at the table; taken from the path
+            result.reusedVisits = pool[found].visits;
+            root = reroot(found);
+        }
+    }
+    if (root < 0) {
+        reset();
+        root = newNode(-1, seat, PlayerAction::NONE, 0);
+    }
+    rootState = actual;
+    searcher = seat;
+    roundNumber = game.roundNumber;
+    gameSeed = game.seed;
+
+    for (int i = 0; i < actual.seats; i++) {
+        models[i].aggression = game.players[i].aggression;
+        models[i].tightness = game.players[i].tightness;
+        models[i].suspicion = game.players[i].suspicion;
+    }
+
+    int oddChipSeat = (game.dealerIndex + 1) % actual.seats;
+    CardSet hole = game.players[seat].handMask;
+    CardSet unseen = CardSet::fullDeck() - hole - game.boardMask;
+    uint8_t cards[52];
+    uint32_t cardCount = 0;
+    for (CardSet rest = unseen; !rest.empty(); ) {
+        cards[cardCount++] = rest.popLowest().index();
+    }
+
+    Rng rng(settings.seed);
+    Deal deal;
+    MctsNode* nodes = pool.data();
+    int32_t path[MCTS_MAX_DEPTH + 1];
+    Option options[MAX_ACTIONS];
+    double low = std::numeric_limits<double>::max();
+    double high = std::numeric_limits<double>::lowest();
+
+    // The quick rule of AIPolicy, on this determinization's cards
+    auto quickDecision = [&](const MctsState& state, int& raiseAmount) {
+        int actor = state.toAct;
+        Player& model = models[actor];
+        model.hp = state.stack[actor];
+        int call = state.highBet - state.bet[actor];
+        double strength = AIPlayer::quickStrength(deal.hole[actor], deal.board[state.street], seatCount(state.inHand) - 1);
+        PlayerAction action = AIPlayer::decideFromStrength(model, strength, call, MIN_BET);
+        raiseAmount = action == PlayerAction::RAISE ? AIPlayer::decideRaiseAmount(model, call, MIN_BET, MAX_BET) : 0;
+        return action;
+    };
+
+    for (;;) {
+        if (settings.maxIterations && result.iterations >= settings.maxIterations) break;
+        if (result.iterations > 0 && settings.timeBudget.count() > 0
+            && std::chrono::steady_clock::now() - start >= settings.timeBudget) {
+            break;
+        }
+        result.iterations++;
+
+        // Determinize: partial Fisher-Yates over the unseen cards
+        uint32_t drawn = 0;
+        auto next = [&]() {
+            uint32_t pick = drawn + bounded(rng, cardCount - drawn);
+            std::swap(cards[drawn], cards[pick]);
+            return Card::fromIndex(cards[drawn++]);
+        };
+        CardSet board = game.boardMask;
+        for (int street = 0; street < 4; street++) {
+            while (board.size() < BOARD_CARDS_AT[street]) board.add(next());
+            deal.board[street] = board;
+        }
+        deal.hole[seat] = hole;
+        for (uint32_t rest = actual.inHand & ~seatBit(seat); rest; rest &= rest - 1) {
+            int opponent = nextSeat(rest, 0);
+            CardSet dealt(next());
+            dealt.add(next());
+            deal.hole[opponent] = dealt;
+        }
+
+        // Selection and one expansion, then the quick rule to the end of the hand
+        MctsState state = actual;
+        int depth = 0;
+        path[depth++] = root;
+        int32_t node = root;
+        bool expanded = false;
+        while (!state.over() && !expanded && depth <= MCTS_MAX_DEPTH) {
+            int32_t child = -1;
+            PlayerAction action;
+            int raiseAmount = 0;
+            if (state.toAct == seat) {
+                int count = searchOptions(state, options);
+                for (int i = 0; i < count && child < 0; i++) {
+                    if (findChild(node, options[i].action, options[i].raiseAmount) < 0) {
+                        action = options[i].action;
+                        raiseAmount = options[i].raiseAmount;
+                        child = newNode(node, seat, action, raiseAmount);
+                        expanded = true;
+                        if (child < 0) break;   // Pool full
+                    }
+                }
+                if (!expanded) {
+                    // Every option tried: UCB1 on rewards scaled to the range seen so far
+                    double range = high > low ? high - low : 1.0;
+                    double logVisits = std::log(static_cast<double>(nodes[node].visits));
+                    double bestScore = std::numeric_limits<double>::lowest();
+                    for (int32_t c = nodes[node].firstChild; c >= 0; c = nodes[c].nextSibling) {
+                        double mean = nodes[c].reward / nodes[c].visits;
+                        double score = (mean - low) / range
+                                     + settings.exploration * std::sqrt(logVisits / nodes[c].visits);
+                        if (score > bestScore) {
+                            bestScore = score;
+                            child = c;
+                        }
+                    }
+                    action = static_cast<PlayerAction>(nodes[child].action);
+                    raiseAmount = nodes[child].raiseAmount;
+                }
+            } else {
+                action = quickDecision(state, raiseAmount);
+                child = findChild(node, action, raiseAmount);
+                if (child < 0) {
+                    child = newNode(node, state.toAct, action, raiseAmount);
+                    expanded = true;
+                }
+            }
+            if (child < 0) break;
+            state.apply(action, raiseAmount);
+            path[depth++] = child;
+            node = child;
+        }
+        while (!state.over()) {
+            int raiseAmount;
+            PlayerAction action = quickDecision(state, raiseAmount);
+            state.apply(action, raiseAmount);
+        }
+
+        // Everybody's HP at the end of the hand, main and side pots paid as BloodGambleGame::awardPot does
+        int contributed[MAX_SEATS];
+        uint32_t strength[MAX_SEATS] = {};
+        for (int i = 0; i < state.seats; i++) {
+            contributed[i] = game.contributed[i] + actual.stack[i] - state.stack[i];
+        }
+        if (seatCount(state.inHand) > 1) {
+            for (uint32_t rest = state.inHand; rest; rest &= rest - 1) {
+                int player = nextSeat(rest, 0);
+                strength[player] = HandEvaluator::evaluate(deal.hole[player] | deal.board[3]);
+            }
+        }
+        PotSplit split = splitPots(contributed, state.seats, state.inHand, strength, oddChipSeat);
+        double finalHp[MAX_SEATS];
+        for (int i = 0; i < state.seats; i++) {
+            finalHp[i] = state.stack[i] + split.won[i] + split.refunded[i];
+        }
+        low = std::min(low, finalHp[seat]);
+        high = std::max(high, finalHp[seat]);
+
+        nodes[root].visits++;
+        for (int i = 1; i < depth; i++) {
+            MctsNode& visited = nodes[path[i]];
+            visited.visits++;
+            visited.reward += finalHp[visited.seat];
+        }
+    }
+
+    // Most visited option, the better mean on a tie
+    chosen = -1;
+    for (int32_t c = nodes[root].firstChild; c >= 0; c = nodes[c].nextSibling) {
+        if (chosen < 0 || nodes[c].visits > nodes[chosen].visits
+            || (nodes[c].visits == nodes[chosen].visits
+                && nodes[c].reward / std::max(1u, nodes[c].visits) > nodes[chosen].reward / std::max(1u, nodes[chosen].visits))) {
+            chosen = c;
+        }
+    }
+    if (chosen >= 0) {
+        result.action = static_cast<PlayerAction>(nodes[chosen].action);
+        result.raiseAmount = nodes[chosen].raiseAmount;
+    }
+    result.nodes = used;
+    return result;
+}
@@ -0,0 +1,40 @@
+#include "../../include/ai/Strategy.h"
+#include <cstring>
+
+bool StrategyTable::load(const std::string& path, std::string& error) {
+    rows = nullptr;
+    trainedBuckets = 0;
+    if (!file.open(path)) {
+        error = "cannot map " + path;
+        return false;
+    }
+
+    StrategyFileHeader header;
+    if (file.size() < sizeof(header)) {
+        error = path + " is too short";
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, STRATEGY_MAGIC, sizeof(header.magic)) != 0
+        || header.version != STRATEGY_VERSION) {
+        error = path + " is not a version " + std::to_string(STRATEGY_VERSION) + " strategy";
+        return false;
+    }
+    if (header.streets != STRATEGY_STREETS || header.buckets != STRATEGY_BUCKETS
+        || header.positions != STRATEGY_POSITIONS || header.callClasses != STRATEGY_CALL_CLASSES
+        || header.potClasses != STRATEGY_POT_CLASSES || header.actions != STRATEGY_ACTIONS
+        || header.infosets != static_cast<uint32_t>(STRATEGY_INFOSETS)
+        || file.size() != sizeof(header) + static_cast<size_t>(STRATEGY_INFOSETS) * STRATEGY_ACTIONS) {
+        error = path + " was trained for a different abstraction";
+        return false;
+    }
+
+    rows = file.data() + sizeof(header);
+    trainedBuckets = header.bucketTable;
+    return true;
+}
+
+StrategyTable& StrategyTable::global() {
+    static StrategyTable table;
+    return table;
+}
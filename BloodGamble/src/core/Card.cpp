@@ -8,105 +8,98 @@
 #define YELLOW  "\033[33m"      // Your cards
 #define CYAN    "\033[36m"      // Board cards
 
-std::string Card::toString() const {
-    std::string rankStr;
-    if (rank <= Rank::TEN) rankStr = std::to_string(static_cast<int>(rank));
-    else if (rank == Rank::JACK) rankStr = "J";
-    else if (rank == Rank::QUEEN) rankStr = "Q";
-    else if (rank == Rank::KING) rankStr = "K";
-    else rankStr = "A";
-    
-    std::string suitStr;
-    std::string color;
-    switch (suit) {
-        case Suit::HEARTS: 
-            suitStr = "H"; 
-            color = RED;
-            break;
-        case Suit::DIAMONDS: 
-            suitStr = "D"; 
-            color = RED;
-            break;
-        case Suit::CLUBS: 
-            suitStr = "C"; 
-            color = BLACK;
-            break;
-        case Suit::SPADES: 
-            suitStr = "S"; 
-            color = BLACK;
-            break;
-    }
-    
-    return std::string(color) + BOLD + rankStr + suitStr + RESET;
-}
+namespace {
+
+enum CardStyle { PLAIN, YOURS, BOARD, STYLE_COUNT };
+
+// Every card pre-rendered in each style, indexed by Card::index()
+struct CardStrings {
+    std::string text[STYLE_COUNT][64];
+
+    CardStrings() {
+        static const char* const RANKS[] = {"2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A"};
+        static const char* const SUITS[] = {"H", "D", "C", "S"};
+        static const char* const SUIT_COLORS[] = {RED, RED, BLACK, BLACK};
 
-std::string Card::toStringYours() const {
-    std::string rankStr;
-    if (rank <= Rank::TEN) rankStr = std::to_string(static_cast<int>(rank));
-    else if (rank == Rank::JACK) rankStr = "J";
-    else if (rank == Rank::QUEEN) rankStr = "Q";
-    else if (rank == Rank::KING) rankStr = "K";
-    else rankStr = "A";
-    
-    std::string suitStr;
-    switch (suit) {
-        case Suit::HEARTS: suitStr = "H"; break;
-        case Suit::DIAMONDS: suitStr = "D"; break;
-        case Suit::CLUBS: suitStr = "C"; break;
-        case Suit::SPADES: suitStr = "S"; break;
+        for (int suit = 0; suit < 4; suit++) {
+            for (int rank = 0; rank < 13; rank++) {
+                std::string face = std::string(BOLD) + RANKS[rank] + SUITS[suit] + RESET;
+                int index = suit * 16 + rank;
+                text[PLAIN][index] = SUIT_COLORS[suit] + face;
+                text[YOURS][index] = YELLOW + face;
+                text[BOARD][index] = CYAN + face;
+            }
+        }
     }
-    
-    return std::string(YELLOW) + BOLD + rankStr + suitStr + RESET;
+};
+
+const CardStrings CARD_STRINGS;
+
+} // namespace
+
+const std::string& Card::toString() const {
+    return CARD_STRINGS.text[PLAIN][index()];
 }
 
-std::string Card::toStringBoard() const {
-    std::string rankStr;
-    if (rank <= Rank::TEN) rankStr = std::to_string(static_cast<int>(rank));
-    else if (rank == Rank::JACK) rankStr = "J";
-    else if (rank == Rank::QUEEN) rankStr = "Q";
-    else if (rank == Rank::KING) rankStr = "K";
-    else rankStr = "A";
-    
-    std::string suitStr;
-    switch (suit) {
-        case Suit::HEARTS: suitStr = "H"; break;
-        case Suit::DIAMONDS: suitStr = "D"; break;
-        case Suit::CLUBS: suitStr = "C"; break;
-        case Suit::SPADES: suitStr = "S"; break;
-    }
-    
-    return std::string(CYAN) + BOLD + rankStr + suitStr + RESET;
+const std::string& Card::toStringYours() const {
+    return CARD_STRINGS.text[YOURS][index()];
 }
 
-Deck::Deck(unsigned int seed) : rng(seed) {
-    reset();
+const std::string& Card::toStringBoard() const {
+    return CARD_STRINGS.text[BOARD][index()];
 }
 
-void Deck::reset() {
-    cards.clear();
+Deck::Deck(uint64_t seed, uint64_t stream) : slot{}, dealt(0), rng(seed, stream) {
+    uint8_t position = 0;
     for (int s = 0; s < 4; s++) {
         for (int r = 2; r <= 14; r++) {
-            cards.emplace_back(static_cast<Suit>(s), static_cast<Rank>(r));
+            uint8_t index = Card(static_cast<Suit>(s), static_cast<Rank>(r)).index();
+            ids[position] = index;
+            slot[index] = position++;
         }
     }
-    shuffle();
+    undealt = CardSet::fullDeck();
 }
 
-void Deck::shuffle() {
-    std::shuffle(cards.begin(), cards.end(), rng);
+void Deck::swapSlots(uint8_t a, uint8_t b) {
+    std::swap(ids[a], ids[b]);
+    slot[ids[a]] = a;
+    slot[ids[b]] = b;
+}
+
+// Every draw picks uniformly from the undealt cards, so their order never
+// needs restoring
+void Deck::reset() {
+    dealt = 0;
+    undealt = CardSet::fullDeck();
+}
+
+void Deck::shuffleRemaining() {
+    for (uint32_t i = DECK_SIZE - dealt; i > 1; i--) {
+        swapSlots(static_cast<uint8_t>(dealt + i - 1), static_cast<uint8_t>(dealt + bounded(rng, i)));
+    }
 }
 
 Card Deck::draw() {
-    if (cards.empty()) {
+    if (empty()) {
         throw std::runtime_error("Cannot draw from empty deck!");
     }
-    Card card = cards.back();
-    cards.pop_back();
+    swapSlots(dealt, static_cast<uint8_t>(dealt + bounded(rng, DECK_SIZE - dealt)));
+    Card card = Card::fromIndex(ids[dealt++]);
+    undealt.remove(card);
     return card;
 }
 
+bool Deck::remove(Card card) {
+    if (!undealt.contains(card)) return false;
+    swapSlots(dealt++, slot[card.index()]);
+    undealt.remove(card);
+    return true;
+}
+
 std::vector<Card> Deck::draw(int count) {
     std::vector<Card> drawn;
+    drawn.reserve(count);
     for (int i = 0; i < count; i++) {
         drawn.push_back(draw());
     }
@@ -1,161 +1,176 @@
 #include "../../include/core/HandEvaluator.h"
+#include "../../include/core/HandTables.h"
 #include <algorithm>
-#include <unordered_map>
 
-std::string HandValue::getDescription() const {
-    switch (rank) {
-        case HandRank::ROYAL_FLUSH: return "Royal Flush";
-        case HandRank::STRAIGHT_FLUSH: return "Straight Flush";
-        case HandRank::FOUR_KIND: return "Four of a Kind";
-        case HandRank::FULL_HOUSE: return "Full House";
-        case HandRank::FLUSH: return "Flush";
-        case HandRank::STRAIGHT: return "Straight";
-        case HandRank::THREE_KIND: return "Three of a Kind";
-        case HandRank::TWO_PAIR: return "Two Pair";
-        case HandRank::PAIR: return "One Pair";
-        case HandRank::HIGH_CARD: return "High Card";
-        default: return "Unknown";
-    }
+namespace {
+
+constexpr uint32_t category(HandRank rank) {
+    return static_cast<uint32_t>(rank) << STRENGTH_CATEGORY_SHIFT;
 }
 
-bool HandValue::operator>(const HandValue& other) const {
-    if (rank != other.rank) return rank > other.rank;
-    return tieBreakers > other.tieBreakers;
+constexpr int bitCount(uint32_t mask) {
+    int count = 0;
+    for (; mask; mask &= mask - 1) count++;
+    return count;
 }
 
-HandValue HandEvaluator::evaluateHand(const std::vector<Card>& allCards) {
-    std::vector<Card> cards = allCards;
-    std::sort(cards.begin(), cards.end(), [](const Card& a, const Card& b) {
-        return a.rank > b.rank;
-    });
-    
-    // Check for flush
-    std::unordered_map<Suit, int> suitCounts;
-    for (const auto& card : cards) {
-        suitCounts[card.suit]++;
-    }
-    
-    bool isFlush = false;
-    Suit flushSuit;
-    for (const auto& pair : suitCounts) {
-        if (pair.second >= 5) {
-            isFlush = true;
-            flushSuit = pair.first;
-            break;
-        }
-    }
-    
-    // Check for straight
-    std::vector<Rank> uniqueRanks;
-    for (const auto& card : cards) {
-        if (std::find(uniqueRanks.begin(), uniqueRanks.end(), card.rank) == uniqueRanks.end()) {
-            uniqueRanks.push_back(card.rank);
-        }
-    }
-    std::sort(uniqueRanks.begin(), uniqueRanks.end(), std::greater<Rank>());
-    
-    bool isStraight = false;
-    Rank straightHigh = Rank::TWO;
-    
-    for (size_t i = 0; i <= uniqueRanks.size() - 5; i++) {
-        bool consecutive = true;
-        for (size_t j = 1; j < 5; j++) {
-            if (static_cast<int>(uniqueRanks[i + j]) != static_cast<int>(uniqueRanks[i + j - 1]) - 1) {
-                consecutive = false;
-                break;
-            }
-        }
-        if (consecutive) {
-            isStraight = true;
-            straightHigh = uniqueRanks[i];
-            break;
-        }
-    }
-    
-    // Check for A-2-3-4-5 straight (wheel)
-    if (!isStraight && uniqueRanks.size() >= 5) {
-        if (uniqueRanks[0] == Rank::ACE &&
-            std::find(uniqueRanks.begin(), uniqueRanks.end(), Rank::FIVE) != uniqueRanks.end() &&
-            std::find(uniqueRanks.begin(), uniqueRanks.end(), Rank::FOUR) != uniqueRanks.end() &&
-            std::find(uniqueRanks.begin(), uniqueRanks.end(), Rank::THREE) != uniqueRanks.end() &&
-            std::find(uniqueRanks.begin(), uniqueRanks.end(), Rank::TWO) != uniqueRanks.end()) {
-            isStraight = true;
-            straightHigh = Rank::FIVE;
+constexpr uint32_t topBits(uint32_t mask, int keep) {
+    while (bitCount(mask) > keep) mask &= mask - 1; // drop lowest rank
+    return mask;
+}
+
+// Bit of the highest card of the best straight in the mask, 0 if none
+constexpr uint32_t straightHighBit(uint32_t mask) {
+    for (int high = 12; high >= 4; high--) {
+        uint32_t window = 0x1Fu << (high - 4);
+        if ((mask & window) == window) return 1u << high;
+    }
+    const uint32_t wheel = (1u << 12) | 0xFu; // A-2-3-4-5
+    return (mask & wheel) == wheel ? 1u << 3 : 0;
+}
+
+constexpr HandTables buildHandTables() {
+    HandTables t{};
+    for (uint32_t mask = 0; mask < RANK_MASK_SIZE; mask++) {
+        uint32_t high = straightHighBit(mask);
+
+        t.straight[mask] = high ? category(HandRank::STRAIGHT) | (high << STRENGTH_PRIMARY_SHIFT) : 0;
+        if (bitCount(mask) >= 5) {
+            if (high == (1u << 12)) t.flush[mask] = category(HandRank::ROYAL_FLUSH) | (high << STRENGTH_PRIMARY_SHIFT);
+            else if (high) t.flush[mask] = category(HandRank::STRAIGHT_FLUSH) | (high << STRENGTH_PRIMARY_SHIFT);
+            else t.flush[mask] = category(HandRank::FLUSH) | topBits(mask, 5);
         }
+        t.top1[mask] = static_cast<uint16_t>(topBits(mask, 1));
+        t.top2[mask] = static_cast<uint16_t>(topBits(mask, 2));
+        t.top3[mask] = static_cast<uint16_t>(topBits(mask, 3));
+        t.top5[mask] = static_cast<uint16_t>(topBits(mask, 5));
     }
-    
-    // Count ranks
-    std::unordered_map<Rank, int> rankCounts;
-    for (const auto& card : cards) {
-        rankCounts[card.rank]++;
-    }
-    
-    std::vector<std::pair<int, Rank>> countRankPairs;
-    for (const auto& pair : rankCounts) {
-        countRankPairs.emplace_back(pair.second, pair.first);
-    }
-    std::sort(countRankPairs.begin(), countRankPairs.end(), std::greater<std::pair<int, Rank>>());
-    
-    // Determine hand rank
-    if (isStraight && isFlush) {
-        if (straightHigh == Rank::ACE) {
-            return {HandRank::ROYAL_FLUSH, {static_cast<int>(straightHigh)}, "Royal Flush"};
-        } else {
-            return {HandRank::STRAIGHT_FLUSH, {static_cast<int>(straightHigh)}, "Straight Flush"};
-        }
+    return t;
+}
+
+} // namespace
+
+constexpr HandTables HAND_TABLES = buildHandTables();
+
+namespace {
+
+const char* const RANK_NAMES[13] = {
+    "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Ten", "Jack", "Queen", "King", "Ace"
+};
+const char* const RANK_PLURALS[13] = {
+    "Twos", "Threes", "Fours", "Fives", "Sixes", "Sevens", "Eights", "Nines", "Tens", "Jacks", "Queens", "Kings", "Aces"
+};
+
+int highestBit(uint32_t mask) {
+    int bit = 12;
+    while (bit > 0 && !(mask & (1u << bit))) bit--;
+    return bit;
+}
+
+} // namespace
+
+HandRank HandValue::rank() const {
+    return HandEvaluator::rankOf(strength);
+}
+
+std::string HandValue::description() const {
+    uint32_t primary = (strength >> STRENGTH_PRIMARY_SHIFT) & (RANK_MASK_SIZE - 1);
+    uint32_t kickers = strength & (RANK_MASK_SIZE - 1);
+    int top = highestBit(primary);
+
+    switch (rank()) {
+        case HandRank::ROYAL_FLUSH: return "Royal Flush";
+        case HandRank::STRAIGHT_FLUSH: return std::string("Straight Flush, ") + RANK_NAMES[top] + " high";
+        case HandRank::FOUR_KIND: return std::string("Four of a Kind, ") + RANK_PLURALS[top];
+        case HandRank::FULL_HOUSE:
+            return std::string("Full House, ") + RANK_PLURALS[top] + " over " + RANK_PLURALS[highestBit(kickers)];
+        case HandRank::FLUSH: return std::string("Flush, ") + RANK_NAMES[highestBit(kickers)] + " high";
+        case HandRank::STRAIGHT: return std::string("Straight, ") + RANK_NAMES[top] + " high";
+        case HandRank::THREE_KIND: return std::string("Three of a Kind, ") + RANK_PLURALS[top];
+        case HandRank::TWO_PAIR:
+            return std::string("Two Pair, ") + RANK_PLURALS[top] + " and "
+                 + RANK_PLURALS[highestBit(primary & ~(1u << top))];
+        case HandRank::PAIR: return std::string("One Pair, ") + RANK_PLURALS[top];
+        case HandRank::HIGH_CARD: return std::string("High Card, ") + RANK_NAMES[highestBit(kickers)];
+        default: return "Unknown";
     }
-    
-    if (countRankPairs[0].first == 4) {
-        return {HandRank::FOUR_KIND, {static_cast<int>(countRankPairs[0].second), static_cast<int>(countRankPairs[1].second)}, "Four of a Kind"};
+}
+
+uint32_t HandEvaluator::evaluate(const Card* cards, size_t count) {
+    uint32_t suits[4] = {0, 0, 0, 0};
+    for (size_t i = 0; i < count; i++) {
+        suits[static_cast<int>(cards[i].suit)] |= 1u << (static_cast<int>(cards[i].rank) - 2);
     }
-    
-    if (countRankPairs[0].first == 3 && countRankPairs[1].first >= 2) {
-        return {HandRank::FULL_HOUSE, {static_cast<int>(countRankPairs[0].second), static_cast<int>(countRankPairs[1].second)}, "Full House"};
+    return evaluateSuits(suits[0], suits[1], suits[2], suits[3]);
+}
+
+uint32_t HandEvaluator::evaluate(CardSet cards) {
+    return evaluateSuits(cards.suitMask(0), cards.suitMask(1), cards.suitMask(2), cards.suitMask(3));
+}
+
+uint32_t HandEvaluator::evaluateSuits(uint32_t hearts, uint32_t diamonds, uint32_t clubs, uint32_t spades) {
+    const HandTables& t = HAND_TABLES;
+
+    // With at most 7 cards only one suit can hold a flush
+    uint32_t flush = std::max(std::max(t.flush[hearts], t.flush[diamonds]),
+                              std::max(t.flush[clubs], t.flush[spades]));
+    if (flush >= category(HandRank::STRAIGHT_FLUSH)) return flush;
+
+    // Per-rank card counts as bit planes (carry-save add of the four suit masks)
+    uint32_t ranks = hearts | diamonds | clubs | spades;
+    uint32_t sumHD = hearts ^ diamonds, carryHD = hearts & diamonds;
+    uint32_t sumCS = clubs ^ spades, carryCS = clubs & spades;
+    uint32_t odd = sumHD ^ sumCS;
+    uint32_t twos = carryHD ^ carryCS ^ (sumHD & sumCS);
+    uint32_t quads = hearts & diamonds & clubs & spades;
+    uint32_t trips = odd & twos;
+    uint32_t pairs = twos & ~odd;
+
+    if (quads) {
+        return category(HandRank::FOUR_KIND) | (quads << STRENGTH_PRIMARY_SHIFT) | t.top1[ranks & ~quads];
     }
-    
-    if (isFlush) {
-        std::vector<int> flushCards;
-        for (const auto& card : cards) {
-            if (card.suit == flushSuit) {
-                flushCards.push_back(static_cast<int>(card.rank));
-            }
+
+    uint32_t topTrips = t.top1[trips];
+    if (trips) {
+        uint32_t fillers = (trips ^ topTrips) | pairs;
+        if (fillers) {
+            return category(HandRank::FULL_HOUSE) | (topTrips << STRENGTH_PRIMARY_SHIFT) | t.top1[fillers];
         }
-        std::sort(flushCards.begin(), flushCards.end(), std::greater<int>());
-        flushCards.resize(5);
-        return {HandRank::FLUSH, flushCards, "Flush"};
     }
-    
-    if (isStraight) {
-        return {HandRank::STRAIGHT, {static_cast<int>(straightHigh)}, "Straight"};
+
+    if (flush) return flush;
+    if (t.straight[ranks]) return t.straight[ranks];
+
+    if (trips) {
+        return category(HandRank::THREE_KIND) | (topTrips << STRENGTH_PRIMARY_SHIFT) | t.top2[ranks & ~topTrips];
     }
-    
-    if (countRankPairs[0].first == 3) {
-        std::vector<int> kickers;
-        for (size_t i = 1; i < countRankPairs.size() && kickers.size() < 2; i++) {
-            kickers.push_back(static_cast<int>(countRankPairs[i].second));
-        }
-        return {HandRank::THREE_KIND, {static_cast<int>(countRankPairs[0].second), kickers[0], kickers[1]}, "Three of a Kind"};
+
+    if (pairs & (pairs - 1)) {
+        uint32_t twoPair = t.top2[pairs];
+        return category(HandRank::TWO_PAIR) | (twoPair << STRENGTH_PRIMARY_SHIFT) | t.top1[ranks & ~twoPair];
     }
-    
-    if (countRankPairs[0].first == 2 && countRankPairs[1].first == 2) {
-        int kicker = static_cast<int>(countRankPairs[2].second);
-        return {HandRank::TWO_PAIR, {std::max(static_cast<int>(countRankPairs[0].second), static_cast<int>(countRankPairs[1].second)),
-                                    std::min(static_cast<int>(countRankPairs[0].second), static_cast<int>(countRankPairs[1].second)),
-                                    kicker}, "Two Pair"};
+
+    if (pairs) {
+        return category(HandRank::PAIR) | (pairs << STRENGTH_PRIMARY_SHIFT) | t.top3[ranks & ~pairs];
     }
-    
-    if (countRankPairs[0].first == 2) {
-        std::vector<int> kickers;
-        for (size_t i = 1; i < countRankPairs.size() && kickers.size() < 3; i++) {
-            kickers.push_back(static_cast<int>(countRankPairs[i].second));
-        }
-        return {HandRank::PAIR, {static_cast<int>(countRankPairs[0].second), kickers[0], kickers[1], kickers[2]}, "One Pair"};
+
+    return category(HandRank::HIGH_CARD) | t.top5[ranks];
+}
+
+void HandEvaluator::evaluateBatch(const CardSet* hands, uint32_t* out, size_t n) {
+    if (avx2Supported()) {
+        evaluateBatchAvx2(hands, out, n);
+    } else {
+        evaluateBatchScalar(hands, out, n);
     }
-    
-    // High card
-    std::vector<int> highCards;
-    for (size_t i = 0; i < std::min(size_t(5), countRankPairs.size()); i++) {
-        highCards.push_back(static_cast<int>(countRankPairs[i].second));
+}
+
+void HandEvaluator::evaluateBatchScalar(const CardSet* hands, uint32_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = evaluate(hands[i]);
     }
-    return {HandRank::HIGH_CARD, highCards, "High Card"};
-}
\ No newline at end of file
+}
+
+HandRank HandEvaluator::rankOf(uint32_t strength) {
+    return static_cast<HandRank>(strength >> STRENGTH_CATEGORY_SHIFT);
+}
@@ -0,0 +1,116 @@
+#include "../../include/core/HandEvaluator.h"
+#include "../../include/core/HandTables.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+
+namespace {
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+AVX2_TARGET inline __m256i gather32(const uint32_t* table, __m256i index) {
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 4);
+}
+
+// 16-bit tables are gathered as 32-bit words at scale 2 and masked down
+AVX2_TARGET inline __m256i gather16(const uint16_t* table, __m256i index) {
+    __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 2);
+    return _mm256_and_si256(words, _mm256_set1_epi32(0xFFFF));
+}
+
+AVX2_TARGET inline __m256i nonZero(__m256i v) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi32(v, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+}
+
+AVX2_TARGET inline __m256i category(HandRank rank) {
+    return _mm256_set1_epi32(static_cast<int>(rank) << STRENGTH_CATEGORY_SHIFT);
+}
+
+AVX2_TARGET inline __m256i candidate(HandRank rank, __m256i primary, __m256i kickers, __m256i valid) {
+    __m256i value = _mm256_or_si256(category(rank), _mm256_or_si256(_mm256_slli_epi32(primary, STRENGTH_PRIMARY_SHIFT), kickers));
+    return _mm256_and_si256(value, valid);
+}
+
+// Evaluates 8 hands. Every category that the hand can form yields a candidate
+// strength and the best hand is their maximum, which is exactly what the
+// scalar evaluator's early returns select.
+AVX2_TARGET void evaluate8(const CardSet* hands, uint32_t* out) {
+    const HandTables& t = HAND_TABLES;
+    const __m256i rankMask = _mm256_set1_epi32(0x1FFF);
+    const __m256i evenOdd = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    // Split each 64-bit set into its hearts|diamonds and clubs|spades halves
+    __m256i first = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hands)), evenOdd);
+    __m256i second = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hands + 4)), evenOdd);
+    __m256i low = _mm256_permute2x128_si256(first, second, 0x20);
+    __m256i high = _mm256_permute2x128_si256(first, second, 0x31);
+
+    __m256i hearts = _mm256_and_si256(low, rankMask);
+    __m256i diamonds = _mm256_and_si256(_mm256_srli_epi32(low, 16), rankMask);
+    __m256i clubs = _mm256_and_si256(high, rankMask);
+    __m256i spades = _mm256_and_si256(_mm256_srli_epi32(high, 16), rankMask);
+
+    __m256i flush = _mm256_max_epu32(_mm256_max_epu32(gather32(t.flush, hearts), gather32(t.flush, diamonds)),
+                                     _mm256_max_epu32(gather32(t.flush, clubs), gather32(t.flush, spades)));
+
+    __m256i ranks = _mm256_or_si256(_mm256_or_si256(hearts, diamonds), _mm256_or_si256(clubs, spades));
+    __m256i sumHD = _mm256_xor_si256(hearts, diamonds);
+    __m256i sumCS = _mm256_xor_si256(clubs, spades);
+    __m256i odd = _mm256_xor_si256(sumHD, sumCS);
+    __m256i twos = _mm256_xor_si256(_mm256_xor_si256(_mm256_and_si256(hearts, diamonds), _mm256_and_si256(clubs, spades)),
+                                    _mm256_and_si256(sumHD, sumCS));
+    __m256i quads = _mm256_and_si256(_mm256_and_si256(hearts, diamonds), _mm256_and_si256(clubs, spades));
+    __m256i trips = _mm256_and_si256(odd, twos);
+    __m256i pairs = _mm256_andnot_si256(odd, twos);
+
+    __m256i best = _mm256_max_epu32(flush, gather32(t.straight, ranks));
+    best = _mm256_max_epu32(best, gather16(t.top5, ranks));
+
+    __m256i quadKicker = gather16(t.top1, _mm256_andnot_si256(quads, ranks));
+    best = _mm256_max_epu32(best, candidate(HandRank::FOUR_KIND, quads, quadKicker, nonZero(quads)));
+
+    __m256i topTrips = gather16(t.top1, trips);
+    __m256i fillers = _mm256_or_si256(_mm256_xor_si256(trips, topTrips), pairs);
+    __m256i fullValid = _mm256_and_si256(nonZero(trips), nonZero(fillers));
+    best = _mm256_max_epu32(best, candidate(HandRank::FULL_HOUSE, topTrips, gather16(t.top1, fillers), fullValid));
+
+    __m256i tripKickers = gather16(t.top2, _mm256_andnot_si256(topTrips, ranks));
+    best = _mm256_max_epu32(best, candidate(HandRank::THREE_KIND, topTrips, tripKickers, nonZero(trips)));
+
+    __m256i twoPair = gather16(t.top2, pairs);
+    __m256i twoPairValid = nonZero(_mm256_and_si256(pairs, _mm256_sub_epi32(pairs, _mm256_set1_epi32(1))));
+    __m256i twoPairKicker = gather16(t.top1, _mm256_andnot_si256(twoPair, ranks));
+    best = _mm256_max_epu32(best, candidate(HandRank::TWO_PAIR, twoPair, twoPairKicker, twoPairValid));
+
+    __m256i pairKickers = gather16(t.top3, _mm256_andnot_si256(pairs, ranks));
+    best = _mm256_max_epu32(best, candidate(HandRank::PAIR, pairs, pairKickers, nonZero(pairs)));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), best);
+}
+
+} // namespace
+
+bool HandEvaluator::avx2Supported() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+void HandEvaluator::evaluateBatchAvx2(const CardSet* hands, uint32_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        evaluate8(hands + i, out + i);
+    }
+    evaluateBatchScalar(hands + i, out + i, n - i);
+}
+
+#else
+
+bool HandEvaluator::avx2Supported() {
+    return false;
+}
+
+void HandEvaluator::evaluateBatchAvx2(const CardSet* hands, uint32_t* out, size_t n) {
+    evaluateBatchScalar(hands, out, n);
+}
+
+#endif
@@ -0,0 +1,134 @@
+#include "../../include/core/OpponentStats.h"
+
+namespace {
+
+double rate(float hits, float opportunities, double prior) {
+    return (hits + prior * OPPONENT_PRIOR_WEIGHT) / (opportunities + OPPONENT_PRIOR_WEIGHT);
+}
+
+} // namespace
+
+double OpponentProfile::vpip() const {
+    return rate((*this)[StatCounter::VPIP], (*this)[StatCounter::HANDS], PRIOR_VPIP);
+}
+
+double OpponentProfile::preflopRaise() const {
+    return rate((*this)[StatCounter::PREFLOP_RAISES], (*this)[StatCounter::HANDS], PRIOR_PREFLOP_RAISE);
+}
+
+double OpponentProfile::aggressionFactor() const {
+    // The prior weight split between the two sides in the prior's ratio
+    double aggressivePrior = OPPONENT_PRIOR_WEIGHT * PRIOR_AGGRESSION_FACTOR / (1.0 + PRIOR_AGGRESSION_FACTOR);
+    return ((*this)[StatCounter::AGGRESSIVE] + aggressivePrior)
+         / ((*this)[StatCounter::PASSIVE] + OPPONENT_PRIOR_WEIGHT - aggressivePrior);
+}
+
+double OpponentProfile::foldToRaise() const {
+    return rate((*this)[StatCounter::FOLDS_TO_RAISE], (*this)[StatCounter::RAISES_FACED], PRIOR_FOLD_TO_RAISE);
+}
+
+double OpponentProfile::showdownRate() const {
+    return rate((*this)[StatCounter::SHOWDOWNS], (*this)[StatCounter::FLOPS_SEEN], PRIOR_SHOWDOWN);
+}
+
+OpponentStats::OpponentStats() {
+    for (auto& counter : counters) {
+        counter.store(0.0f, std::memory_order_relaxed);
+    }
+}
+
+OpponentStats::OpponentStats(const OpponentStats& other) {
+    *this = other;
+}
+
+OpponentStats& OpponentStats::operator=(const OpponentStats& other) {
+    OpponentProfile profile = other.read();
+    beginWrite();
+    for (int i = 0; i < STAT_COUNTERS; i++) {
+        counters[i].store(profile.counters[i], std::memory_order_relaxed);
+    }
+    endWrite();
+    handRound = other.handRound;
+    paidThisHand = other.paidThisHand;
+    raisedThisHand = other.raisedThisHand;
+    return *this;
+}
+
+// Sequence lock with a single writer: readers retry instead of waiting
+void OpponentStats::beginWrite() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void OpponentStats::endWrite() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+OpponentProfile OpponentStats::read() const {
+    OpponentProfile profile;
+    uint32_t before, after;
+    do {
+        before = sequence.load(std::memory_order_acquire);
+        for (int i = 0; i < STAT_COUNTERS; i++) {
+            profile.counters[i] = counters[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+    return profile;
+}
+
+void OpponentStats::observe(StatCounter numerator, StatCounter denominator, bool hit) {
+    set(denominator, get(denominator) * OPPONENT_STATS_DECAY + 1.0f);
+    set(numerator, get(numerator) * OPPONENT_STATS_DECAY + (hit ? 1.0f : 0.0f));
+}
+
+void OpponentStats::onAction(int round, GameStage stage, PlayerAction action, int callAmount, bool facingRaise) {
+    bool aggressive = action == PlayerAction::RAISE || action == PlayerAction::ALL_IN;
+    bool paid = aggressive || (action == PlayerAction::CALL && callAmount > 0);
+
+    beginWrite();
+    if (stage == GameStage::PRE_FLOP) {
+        // The seat's first preflop action opens the hand; later ones can only add the hits
+        if (round != handRound) {
+            handRound = round;
+            paidThisHand = raisedThisHand = false;
+            observe(StatCounter::VPIP, StatCounter::HANDS, false);
+            set(StatCounter::PREFLOP_RAISES, get(StatCounter::PREFLOP_RAISES) * OPPONENT_STATS_DECAY);
+        }
+        if (paid && !paidThisHand) {
+            paidThisHand = true;
+            set(StatCounter::VPIP, get(StatCounter::VPIP) + 1.0f);
+        }
+        if (aggressive && !raisedThisHand) {
+            raisedThisHand = true;
+            set(StatCounter::PREFLOP_RAISES, get(StatCounter::PREFLOP_RAISES) + 1.0f);
+        }
+    } else if (paid) {
+        // A ratio rather than a rate: both sides decay at every postflop action that pays
+        set(StatCounter::AGGRESSIVE, get(StatCounter::AGGRESSIVE) * OPPONENT_STATS_DECAY + (aggressive ? 1.0f : 0.0f));
+        set(StatCounter::PASSIVE, get(StatCounter::PASSIVE) * OPPONENT_STATS_DECAY + (aggressive ? 0.0f : 1.0f));
+    }
+    if (facingRaise) {
+        observe(StatCounter::FOLDS_TO_RAISE, StatCounter::RAISES_FACED, action == PlayerAction::FOLD);
+    }
+    endWrite();
+}
+
+void OpponentStats::onFlopSeen() {
+    beginWrite();
+    observe(StatCounter::SHOWDOWNS, StatCounter::FLOPS_SEEN, false);
+    endWrite();
+}
+
+void OpponentStats::onShowdown() {
+    beginWrite();
+    set(StatCounter::SHOWDOWNS, get(StatCounter::SHOWDOWNS) + 1.0f);
+    endWrite();
+}
+
+void OpponentStats::onCheat(bool detected) {
+    beginWrite();
+    observe(StatCounter::CHEATS_DETECTED, StatCounter::CHEATS, detected);
+    endWrite();
+}
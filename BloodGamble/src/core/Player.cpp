@@ -2,25 +2,44 @@
 
 Player::Player(int playerId, bool human, int initialHp)
     : id(playerId), isHuman(human), hp(initialHp), folded(false), allIn(false),
-      suspicion(0.0), aggression(0.5), tightness(0.5) {}
+      suspicion(0.0), aggression(0.5), tightness(0.5) {
+    hand.reserve(2);
+    cheatCooldowns.fill(0);
+}
 
 void Player::dealCards(const std::vector<Card>& cards) {
-    hand = cards;
+    setHand(cards);
     folded = false;
     allIn = false;
 }
 
+void Player::dealCards(Card first, Card second) {
+    setHand(first, second);
+    folded = false;
+    allIn = false;
+}
+
+void Player::setHand(Card first, Card second) {
+    hand.clear();
+    hand.push_back(first);
+    hand.push_back(second);
+    handMask = CardSet(first) | CardSet(second);
+}
+
+void Player::setHand(const std::vector<Card>& cards) {
+    hand = cards;
+    handMask = CardSet();
+    for (const auto& card : cards) {
+        handMask.add(card);
+    }
+}
+
 bool Player::canBet(int amount) const {
     return !folded && !allIn && hp >= amount;
 }
 
 void Player::decreaseCooldowns() {
-    for (auto& pair : cheatCooldowns) {
-        if (pair.second > 0) pair.second--;
+    for (uint8_t& rounds : cheatCooldowns) {
+        rounds -= rounds > 0;
     }
 }
-
-bool Player::canUseCheat(const std::string& cheatName) const {
-    auto it = cheatCooldowns.find(cheatName);
-    return it == cheatCooldowns.end() || it->second <= 0;
-}
\ No newline at end of file
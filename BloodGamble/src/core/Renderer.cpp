@@ -0,0 +1,24 @@
+#include "../../include/core/Renderer.h"
+#include <cstdio>
+#include <algorithm>
+
+Renderer& Renderer::fixed(double value, int precision) {
+    if (!nullSink) {
+        char digits[64];
+        int length = std::snprintf(digits, sizeof(digits), "%.*f", precision, value);
+        if (length > 0) buffer.append(digits, std::min(static_cast<size_t>(length), sizeof(digits) - 1));
+    }
+    return *this;
+}
+
+Renderer& Renderer::rule(char c, int width) {
+    if (!nullSink) buffer.append(width, c);
+    return *this;
+}
+
+void Renderer::flush() {
+    if (nullSink || buffer.empty()) return;
+    std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+    std::fflush(stdout);
+    buffer.clear(); // Keeps the capacity for the next screen
+}
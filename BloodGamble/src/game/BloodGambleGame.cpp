@@ -1,443 +1,441 @@
 #include "../../include/game/BloodGambleGame.h"
 #include <iostream>
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
+#include <cmath>
 
-BloodGambleGame::BloodGambleGame(unsigned int seed) : gameState(seed) {}
+namespace {
+
+// "YOU" for the table's only human, "PLAYER <id>" when several share it, "AI <id>" otherwise
+Renderer& writeName(Renderer& out, const GameState& state, const Player& player) {
+    if (state.isYou(player.id)) return out << "YOU";
+    if (player.isHuman) return out << "PLAYER " << player.id;
+    return out << "AI " << player.id;
+}
+
+} // namespace
+
+BloodGambleGame::BloodGambleGame(uint64_t seed, bool headless, const TableSetup& table, uint64_t stream)
+    : gameState(seed, table, stream), headless(headless), lastRound() {
+    gameState.renderer.setNullSink(headless);
+    for (const auto& player : gameState.players) {
+        if (player.isHuman && !headless) {
+            policies.push_back(std::make_unique<HumanPolicy>());
+        } else if (table.mctsMask & seatBit(player.id)) {
+            MctsSearch::Settings settings;
+            settings.timeBudget = std::chrono::microseconds(table.mctsBudgetUs);
+            policies.push_back(std::make_unique<MctsPolicy>(settings));
+        } else {
+            policies.push_back(std::make_unique<AIPolicy>(headless));
+        }
+    }
+}
+
+BloodGambleGame::BloodGambleGame(const GameState& state)
+    : gameState(state), headless(true), lastRound() {
+    gameState.renderer.setNullSink(true);
+    gameState.history = nullptr;
+    for (size_t seat = 0; seat < gameState.players.size(); seat++) {
+        policies.push_back(std::make_unique<AIPolicy>(true));
+    }
+}
+
+void BloodGambleGame::setPolicy(int seat, std::unique_ptr<PlayerPolicy> policy) {
+    policies[seat] = std::move(policy);
+}
+
+void BloodGambleGame::setHistory(HandHistory* history) {
+    gameState.history = history;
+    if (history) {
+        // The round field carries the seed's high half; no round has started yet
+        history->record({RecordType::GAME_START, static_cast<uint8_t>(gameState.players.size()), 0, 0,
+                         static_cast<uint32_t>(gameState.seed >> 32), static_cast<int32_t>(gameState.humanMask),
+                         static_cast<uint32_t>(gameState.seed)});
+    }
+}
 
 void BloodGambleGame::run() {
-    std::cout << "=== BLOOD GAMBLE ===\n";
-    std::cout << "A poker game where lives are the stakes!\n\n";
-    
+    gameState.renderer << "=== BLOOD GAMBLE ===\n";
+    gameState.renderer << "A poker game where lives are the stakes!\n\n";
+
     while (!gameState.gameOver()) {
         playRound();
     }
-    
+
     endGame();
 }
 
-void BloodGambleGame::playRound() {
+RoundSummary BloodGambleGame::playRound() {
     gameState.roundNumber++;
-    std::cout << "\n" << std::string(50, '=') << "\n";
-    std::cout << "ROUND " << gameState.roundNumber << "\n";
-    std::cout << std::string(50, '=') << "\n";
-    
+    lastRound = RoundSummary();
+    gameState.record(RecordType::ROUND_START, gameState.dealerIndex, 0, 0, 0,
+                     static_cast<uint32_t>(std::llround(gameState.vigilance * 1e6)));
+    Renderer& out = gameState.renderer;
+    out << "\n";
+    out.rule() << "\n";
+    out << "ROUND " << gameState.roundNumber << "\n";
+    out.rule() << "\n";
+
     // Reset for new round
     gameState.deck.reset();
-    gameState.board.clear();
+    gameState.clearBoard();
     gameState.pot = 0;
     std::fill(gameState.currentBets.begin(), gameState.currentBets.end(), 0);
-    
+    std::fill(gameState.contributed.begin(), gameState.contributed.end(), 0);
+
     // Reset player states for new round
     for (auto& player : gameState.players) {
         player.folded = false;
         player.allIn = false;
     }
-    
+    gameState.inHandMask = 0;
+    gameState.allInMask = 0;
+
     // Deal hole cards
     for (auto& player : gameState.players) {
         if (player.hp > 0) {
-            player.dealCards(gameState.deck.draw(2));
+            Card first = gameState.deck.draw();
+            player.dealCards(first, gameState.deck.draw());
+            gameState.inHandMask |= seatBit(player.id);
+            gameState.record(RecordType::DEAL, player.id, player.hand[0].index(), player.hand[1].index());
         }
     }
-    
+
     // Post blinds
     postBlinds();
-    
-    // Play each stage
-    for (int stageInt = 0; stageInt <= 4; stageInt++) {
+
+    RoundSummary summary = playStages(GameStage::PRE_FLOP);
+    if (gameState.history) gameState.history->endRound();
+    return summary;
+}
+
+RoundSummary BloodGambleGame::finishRound() {
+    lastRound = RoundSummary();
+    return playStages(gameState.stage);
+}
+
+// Plays stage `from` onwards; the board for `from` is already dealt
+RoundSummary BloodGambleGame::playStages(GameStage from) {
+    for (int stageInt = static_cast<int>(from); stageInt <= 4; stageInt++) {
         gameState.stage = static_cast<GameStage>(stageInt);
-        
-        if (gameState.stage == GameStage::FLOP) {
-            std::cout << "\n=== FLOP ===\n";
-            gameState.deck.draw(); // Burn card
-            auto flopCards = gameState.deck.draw(3);
-            gameState.board.insert(gameState.board.end(), flopCards.begin(), flopCards.end());
-            std::cout << "Board: ";
-            for (const auto& card : gameState.board) {
-                std::cout << card.toStringBoard() << " ";
-            }
-            std::cout << "\n";
-        } else if (gameState.stage == GameStage::TURN) {
-            std::cout << "\n=== TURN ===\n";
-            gameState.deck.draw(); // Burn card
-            gameState.board.push_back(gameState.deck.draw());
-            std::cout << "Board: ";
-            for (const auto& card : gameState.board) {
-                std::cout << card.toStringBoard() << " ";
-            }
-            std::cout << "\n";
-        } else if (gameState.stage == GameStage::RIVER) {
-            std::cout << "\n=== RIVER ===\n";
-            gameState.deck.draw(); // Burn card
-            gameState.board.push_back(gameState.deck.draw());
-            std::cout << "Board: ";
-            for (const auto& card : gameState.board) {
-                std::cout << card.toStringBoard() << " ";
-            }
-            std::cout << "\n";
-        } else if (gameState.stage == GameStage::SHOWDOWN) {
+
+        if (gameState.stage == GameStage::SHOWDOWN) {
             showdown();
             break;
         }
-        
-        if (gameState.stage != GameStage::SHOWDOWN) {
-            bettingRound();
-            
-            auto activePlayers = gameState.getActivePlayers();
-            if (activePlayers.size() <= 1) {
-                awardPot(activePlayers.empty() ? -1 : activePlayers[0]);
-                return;
-            }
-            
-            // Reset current bets for next stage (except first stage which has blinds)
-            if (gameState.stage != GameStage::PRE_FLOP) {
-                std::fill(gameState.currentBets.begin(), gameState.currentBets.end(), 0);
+
+        if (stageInt > static_cast<int>(from)) {
+            if (gameState.stage == GameStage::FLOP) {
+                dealBoard(3);
+                showBoard("FLOP");
+                for (uint32_t rest = gameState.inHandMask; rest; rest &= rest - 1) {
+                    gameState.players[nextSeat(rest, 0)].stats.onFlopSeen();
+                }
+            } else if (gameState.stage == GameStage::TURN) {
+                dealBoard(1);
+                showBoard("TURN");
+            } else if (gameState.stage == GameStage::RIVER) {
+                dealBoard(1);
+                showBoard("RIVER");
             }
         }
+
+        bettingRound();
+
+        if (seatCount(gameState.inHandMask) <= 1) {
+            awardPot(nullptr);
+            return lastRound;
+        }
+
+        // Reset current bets for next stage (except first stage which has blinds)
+        if (gameState.stage != GameStage::PRE_FLOP) {
+            std::fill(gameState.currentBets.begin(), gameState.currentBets.end(), 0);
+        }
+    }
+    return lastRound;
+}
+
+// Burns one card, then turns `count` board cards
+void BloodGambleGame::dealBoard(int count) {
+    gameState.deck.draw(); // Burn card
+    for (int i = 0; i < count; i++) {
+        gameState.addBoardCard(gameState.deck.draw());
+        gameState.record(RecordType::BOARD, HISTORY_NO_SEAT, gameState.board.back().index(),
+                         static_cast<int>(gameState.board.size()) - 1);
+    }
+}
+
+void BloodGambleGame::showBoard(const char* title) {
+    Renderer& out = gameState.renderer;
+    if (out.isNullSink()) return;
+
+    out << "\n=== " << title << " ===\n";
+    out << "Board: ";
+    for (const auto& card : gameState.board) {
+        out << card.toStringBoard() << " ";
     }
+    out << "\n";
 }
 
 void BloodGambleGame::postBlinds() {
     // Calculate blind positions
-    gameState.smallBlindIndex = (gameState.dealerIndex + 1) % 4;
-    gameState.bigBlindIndex = (gameState.dealerIndex + 2) % 4;
-    
-    // Post small blind
-    if (gameState.players[gameState.smallBlindIndex].hp > 0) {
-        int sbAmount = std::min(SMALL_BLIND, gameState.players[gameState.smallBlindIndex].hp);
-        gameState.players[gameState.smallBlindIndex].hp -= sbAmount;
-        gameState.pot += sbAmount;
-        gameState.currentBets[gameState.smallBlindIndex] = sbAmount;
-    }
-    
-    // Post big blind
-    if (gameState.players[gameState.bigBlindIndex].hp > 0) {
-        int bbAmount = std::min(BIG_BLIND, gameState.players[gameState.bigBlindIndex].hp);
-        gameState.players[gameState.bigBlindIndex].hp -= bbAmount;
-        gameState.pot += bbAmount;
-        gameState.currentBets[gameState.bigBlindIndex] = bbAmount;
+    // Blinds go to the next two seats still in the game; heads-up the dealer posts the big blind
+    int seats = static_cast<int>(gameState.players.size());
+    gameState.smallBlindIndex = nextSeat(gameState.inHandMask, (gameState.dealerIndex + 1) % seats);
+    gameState.bigBlindIndex = nextSeat(gameState.inHandMask, (gameState.smallBlindIndex + 1) % seats);
+
+    postBlind(gameState.smallBlindIndex, SMALL_BLIND);
+    postBlind(gameState.bigBlindIndex, BIG_BLIND);
+}
+
+// A blind larger than the seat's HP puts it all-in
+void BloodGambleGame::postBlind(int seat, int amount) {
+    Player& player = gameState.players[seat];
+    if (player.hp <= 0) return;
+
+    int posted = std::min(amount, player.hp);
+    player.hp -= posted;
+    gameState.pot += posted;
+    gameState.currentBets[seat] = posted;
+    gameState.contributed[seat] += posted;
+    if (player.hp == 0) {
+        player.allIn = true;
+        gameState.allInMask |= seatBit(seat);
     }
 }
 
 void BloodGambleGame::bettingRound() {
-    std::vector<int> activePlayers = gameState.getActivePlayers();
-    if (activePlayers.size() <= 1) return;
-    
-    // Starting position depends on stage
-    int actionIndex;
-    if (gameState.stage == GameStage::PRE_FLOP) {
-        actionIndex = (gameState.bigBlindIndex + 1) % 4; // UTG starts preflop
-    } else {
-        actionIndex = gameState.smallBlindIndex; // SB starts post-flop
-    }
-    
-    // Find first active player
-    while (std::find(activePlayers.begin(), activePlayers.end(), actionIndex) == activePlayers.end()) {
-        actionIndex = (actionIndex + 1) % 4;
-    }
-    
-    std::vector<bool> hasActed(4, false); // Track who has acted this round
-    bool someoneRaised = false;
-    int actionCount = 0; // Safety counter
-    
-    while (actionCount < 20) { // Safety limit
-        actionCount++;
-        
-        // Update active players
-        activePlayers = gameState.getActivePlayers();
-        if (activePlayers.size() <= 1) break;
-        
-        // Skip inactive players
-        if (std::find(activePlayers.begin(), activePlayers.end(), actionIndex) == activePlayers.end()) {
-            actionIndex = (actionIndex + 1) % 4;
-            continue;
-        }
-        
-        Player& currentPlayer = gameState.players[actionIndex];
-        int currentBet = *std::max_element(gameState.currentBets.begin(), gameState.currentBets.end());
-        
-        // Check if this player needs to act
-        bool needsToAct = (gameState.currentBets[actionIndex] < currentBet && !currentPlayer.allIn) || 
-                         !hasActed[actionIndex]; // Everyone gets at least one chance per stage
-        
-        if (needsToAct) {
-            hasActed[actionIndex] = true;
-            
-            if (currentPlayer.isHuman) {
-                gameState.displayStatus();
-                bool raised = handlePlayerAction(currentPlayer, currentBet, actionIndex);
-                if (raised) {
-                    someoneRaised = true;
-                    // Reset hasActed for everyone except the raiser
-                    std::fill(hasActed.begin(), hasActed.end(), false);
-                    hasActed[actionIndex] = true;
-                }
-            } else {
-                bool raised = handleAIAction(currentPlayer, currentBet, actionIndex);
-                if (raised) {
-                    someoneRaised = true;
-                    // Reset hasActed for everyone except the raiser
-                    std::fill(hasActed.begin(), hasActed.end(), false);
-                    hasActed[actionIndex] = true;
-                }
-            }
-        }
-        
-        // Move to next player
-        actionIndex = (actionIndex + 1) % 4;
-        
-        // Check if betting round is complete
-        bool allActiveHaveActed = true;
-        bool allBetsEqual = true;
-        int maxBet = *std::max_element(gameState.currentBets.begin(), gameState.currentBets.end());
-        
-        for (int pid : activePlayers) {
-            if (!hasActed[pid]) {
-                allActiveHaveActed = false;
-                break;
-            }
-            if (!gameState.players[pid].allIn && gameState.currentBets[pid] != maxBet) {
-                allBetsEqual = false;
-            }
-        }
-        
-        // End round if everyone has acted and bets are equal
-        if (allActiveHaveActed && allBetsEqual) {
-            break;
+    uint32_t& inHand = gameState.inHandMask;
+    if (seatCount(inHand) <= 1) return;
+
+    int seats = static_cast<int>(gameState.players.size());
+    int highestBet = *std::max_element(gameState.currentBets.begin(), gameState.currentBets.end());
+
+    // Everyone who can still bet gets at least one chance per stage
+    uint32_t& pending = gameState.pendingMask;
+    pending = inHand & ~gameState.allInMask;
+
+    // UTG starts preflop, SB post-flop
+    int seat = gameState.stage == GameStage::PRE_FLOP ? (gameState.bigBlindIndex + 1) % seats
+                                                      : gameState.smallBlindIndex;
+
+    while (pending && seatCount(inHand) > 1) {
+        seat = nextSeat(pending, seat);
+        pending &= ~seatBit(seat);
+
+        int callAmount = highestBet - gameState.currentBets[seat];
+        Decision decision = policies[seat]->decide(gameState, seat, callAmount);
+        bool raised = applyDecision(seat, decision, highestBet);
+
+        // Only a bet above the previous high reopens the action, so every
+        // raise war ends once the raisers run out of HP
+        if (raised && gameState.currentBets[seat] > highestBet) {
+            highestBet = gameState.currentBets[seat];
+            pending = inHand & ~gameState.allInMask & ~seatBit(seat);
         }
+        seat = (seat + 1) % seats;
+    }
+}
+
+// Applies and logs a seat's decision; returns true when the action reopens the betting
+bool BloodGambleGame::applyDecision(int seat, const Decision& decision, int currentBet) {
+    Player& player = gameState.players[seat];
+    int hpBefore = player.hp;
+    int callAmount = currentBet - gameState.currentBets[seat];
+    bool raised = applyAction(seat, decision, callAmount);
+    gameState.contributed[seat] += hpBefore - player.hp;
+    if (player.folded) {
+        gameState.inHandMask &= ~seatBit(seat);
+    } else if (player.hp == 0) {
+        player.allIn = true;   // Also when a call or raise used exactly the last HP
+        gameState.allInMask |= seatBit(seat);
     }
+    gameState.record(RecordType::ACTION, seat, static_cast<int>(decision.action), static_cast<int>(gameState.stage),
+                     hpBefore - player.hp, static_cast<uint32_t>(decision.raiseAmount));
+    // Preflop, only a bet above the big blind is a raise to face
+    bool facingRaise = callAmount > 0 && (gameState.stage != GameStage::PRE_FLOP || currentBet > BIG_BLIND);
+    player.stats.onAction(gameState.roundNumber, gameState.stage, decision.action, callAmount, facingRaise);
+    return raised;
 }
 
-bool BloodGambleGame::handlePlayerAction(Player& player, int currentBet, int playerIndex) {
-    int callAmount = currentBet - gameState.currentBets[playerIndex];
-    
-    std::cout << "\n" << std::string(50, '=') << "\n";
-    std::cout << "YOUR TURN! Current bet to call: " << callAmount << " HP\n";
-    std::cout << std::string(50, '=') << "\n";
-    std::cout << "1. Fold\n";
-    std::cout << "2. Call (" << callAmount << " HP)\n";
-    std::cout << "3. Raise\n";
-    std::cout << "4. All-in\n";
-    std::cout << "5. Cheat list\n";
-    std::cout << "6. Use cheat\n";
-    std::cout << "7. Status\n";
-    std::cout << std::string(50, '=') << "\n";
-    std::cout << "Choose (1-7): ";
-    
-    int choice;
-    std::cin >> choice;
-    
-    switch (choice) {
-        case 1: // Fold
+// Moves the decided HP into the pot
+bool BloodGambleGame::applyAction(int seat, const Decision& decision, int callAmount) {
+    Player& player = gameState.players[seat];
+    bool human = gameState.isYou(seat);
+    Renderer& out = gameState.renderer;
+
+    switch (decision.action) {
+        case PlayerAction::FOLD:
             player.folded = true;
-            std::cout << "You fold.\n";
+            if (human) out << "You fold.\n";
+            else writeName(out, gameState, player) << " folds.\n";
             return false;
-            
-        case 2: // Call
+
+        case PlayerAction::CALL:
             if (callAmount > player.hp) {
-                std::cout << "Not enough HP! Going all-in instead.\n";
                 gameState.pot += player.hp;
-                gameState.currentBets[playerIndex] += player.hp;
+                gameState.currentBets[seat] += player.hp;
                 player.hp = 0;
                 player.allIn = true;
+                if (human) out << "Not enough HP! Going all-in instead.\n";
+                else writeName(out, gameState, player) << " goes all-in (forced)!\n";
             } else {
                 player.hp -= callAmount;
                 gameState.pot += callAmount;
-                gameState.currentBets[playerIndex] += callAmount;
-                std::cout << "You call " << callAmount << " HP.\n";
+                gameState.currentBets[seat] += callAmount;
+                if (human) out << "You call " << callAmount << " HP.\n";
+                else writeName(out, gameState, player) << " calls " << callAmount << " HP.\n";
             }
             return false;
-            
-        case 3: // Raise
-            {
-                std::cout << "Enter raise amount: ";
-                int raiseAmount;
-                std::cin >> raiseAmount;
-                int totalBet = callAmount + raiseAmount;
-                
-                if (totalBet > player.hp) {
-                    std::cout << "Not enough HP! Going all-in instead.\n";
-                    gameState.pot += player.hp;
-                    gameState.currentBets[playerIndex] += player.hp;
-                    player.hp = 0;
-                    player.allIn = true;
-                } else {
-                    player.hp -= totalBet;
-                    gameState.pot += totalBet;
-                    gameState.currentBets[playerIndex] += totalBet;
-                    std::cout << "You raise to " << gameState.currentBets[playerIndex] << " HP.\n";
-                }
-                return true; // Raised
-            }
-            
-        case 4: // All-in
-            gameState.pot += player.hp;
-            gameState.currentBets[playerIndex] += player.hp;
-            player.hp = 0;
-            player.allIn = true;
-            std::cout << "You go all-in!\n";
-            return true; // All-in counts as raise
-            
-        case 5: // Cheat list
-            gameState.showCheatList();
-            return handlePlayerAction(player, currentBet, playerIndex); // Retry action
-            
-        case 6: // Use cheat
-            {
-                std::cout << "Enter cheat name: ";
-                std::string cheatName;
-                std::cin >> cheatName;
-                
-                std::cout << "Enter target ID (-1 for no target): ";
-                int targetId;
-                std::cin >> targetId;
-                
-                if (gameState.executeCheat(cheatName, targetId)) {
-                    std::cout << "Cheat executed. ";
-                }
-                return handlePlayerAction(player, currentBet, playerIndex); // Retry action after cheat
-            }
-            
-        case 7: // Status
-            gameState.displayStatus();
-            return handlePlayerAction(player, currentBet, playerIndex); // Retry action
-            
-        default:
-            std::cout << "Invalid choice. Try again.\n";
-            return handlePlayerAction(player, currentBet, playerIndex); // Retry
-    }
-}
 
-bool BloodGambleGame::handleAIAction(Player& ai, int currentBet, int aiIndex) {
-    int callAmount = currentBet - gameState.currentBets[aiIndex];
-    PlayerAction action = AIPlayer::decideAction(ai, gameState, callAmount, MIN_BET);
-    
-    switch (action) {
-        case PlayerAction::FOLD:
-            ai.folded = true;
-            std::cout << "AI " << ai.id << " folds.\n";
-            return false;
-            
-        case PlayerAction::CALL:
-            if (callAmount > ai.hp) {
-                gameState.pot += ai.hp;
-                gameState.currentBets[aiIndex] += ai.hp;
-                ai.hp = 0;
-                ai.allIn = true;
-                std::cout << "AI " << ai.id << " goes all-in (forced)!\n";
-            } else {
-                ai.hp -= callAmount;
-                gameState.pot += callAmount;
-                gameState.currentBets[aiIndex] += callAmount;
-                std::cout << "AI " << ai.id << " calls " << callAmount << " HP.\n";
-            }
-            return false;
-            
         case PlayerAction::RAISE: {
-            int raiseAmount = AIPlayer::decideRaiseAmount(ai, callAmount, MIN_BET, MAX_BET);
-            int totalBet = callAmount + raiseAmount;
-            
-            if (totalBet > ai.hp) {
-                gameState.pot += ai.hp;
-                gameState.currentBets[aiIndex] += ai.hp;
-                ai.hp = 0;
-                ai.allIn = true;
-                std::cout << "AI " << ai.id << " goes all-in!\n";
+            int totalBet = callAmount + decision.raiseAmount;
+
+            if (totalBet > player.hp) {
+                gameState.pot += player.hp;
+                gameState.currentBets[seat] += player.hp;
+                player.hp = 0;
+                player.allIn = true;
+                if (human) out << "Not enough HP! Going all-in instead.\n";
+                else writeName(out, gameState, player) << " goes all-in!\n";
             } else {
-                ai.hp -= totalBet;
+                player.hp -= totalBet;
                 gameState.pot += totalBet;
-                gameState.currentBets[aiIndex] += totalBet;
-                std::cout << "AI " << ai.id << " raises to " << gameState.currentBets[aiIndex] << " HP.\n";
+                gameState.currentBets[seat] += totalBet;
+                if (human) out << "You raise to " << gameState.currentBets[seat] << " HP.\n";
+                else writeName(out, gameState, player) << " raises to " << gameState.currentBets[seat] << " HP.\n";
             }
-            return true;
+            return true; // Raised
         }
-        
+
         case PlayerAction::ALL_IN:
-            gameState.pot += ai.hp;
-            gameState.currentBets[aiIndex] += ai.hp;
-            ai.hp = 0;
-            ai.allIn = true;
-            std::cout << "AI " << ai.id << " goes all-in!\n";
-            return true;
-            
+            gameState.pot += player.hp;
+            gameState.currentBets[seat] += player.hp;
+            player.hp = 0;
+            player.allIn = true;
+            if (human) out << "You go all-in!\n";
+            else writeName(out, gameState, player) << " goes all-in!\n";
+            return true; // All-in counts as raise
+
         default:
             return false;
     }
 }
 
 void BloodGambleGame::showdown() {
-    std::vector<int> activePlayers = gameState.getActivePlayers();
+    SeatList activePlayers = gameState.getActivePlayers();
     if (activePlayers.size() <= 1) {
-        awardPot(activePlayers.empty() ? -1 : activePlayers[0]);
+        awardPot(nullptr);
         return;
     }
-    
-    std::cout << "\n=== SHOWDOWN ===\n";
-    
-    std::vector<std::pair<int, HandValue>> playerHands;
+
+    lastRound.showdown = true;
+    Renderer& out = gameState.renderer;
+    out << "\n=== SHOWDOWN ===\n";
+
+    // One pass: a stronger hand replaces the winners, an equal one joins them
+    uint32_t winners = 0;
+    HandValue best;
+    uint32_t strength[MAX_SEATS] = {};
     for (int pid : activePlayers) {
-        std::vector<Card> allCards = gameState.players[pid].hand;
-        allCards.insert(allCards.end(), gameState.board.begin(), gameState.board.end());
-        HandValue handValue = HandEvaluator::evaluateHand(allCards);
-        playerHands.emplace_back(pid, handValue);
-        
-        std::cout << (gameState.players[pid].isHuman ? "YOU" : ("AI " + std::to_string(pid)));
-        std::cout << ": " << gameState.players[pid].hand[0].toString() 
-                 << " " << gameState.players[pid].hand[1].toString() << "\n";
+        HandValue hand{HandEvaluator::evaluate(gameState.players[pid].handMask | gameState.boardMask)};
+        strength[pid] = hand.strength;
+        gameState.record(RecordType::SHOWDOWN, pid, static_cast<int>(hand.rank()), 0, 0, hand.strength);
+        gameState.players[pid].stats.onShowdown();
+        if (winners == 0 || hand > best) {
+            winners = seatBit(pid);
+            best = hand;
+        } else if (hand == best) {
+            winners |= seatBit(pid);
+        }
+
+        writeName(out, gameState, gameState.players[pid]) << ": " << gameState.players[pid].hand[0].toString()
+            << " " << gameState.players[pid].hand[1].toString() << "\n";
     }
-    
-    // Find winner
-    std::sort(playerHands.begin(), playerHands.end(), 
-             [](const auto& a, const auto& b) { return a.second > b.second; });
-    
-    int winnerId = playerHands[0].first;
-    HandValue winningHand = playerHands[0].second;
-    
-    std::cout << "\nWinner: " << (gameState.players[winnerId].isHuman ? "YOU" : ("AI " + std::to_string(winnerId)));
-    std::cout << " with " << winningHand.description << "!\n";
-    
-    awardPot(winnerId);
+
+    if (!out.isNullSink()) {
+        out << (seatCount(winners) > 1 ? "\nSplit pot: " : "\nWinner: ");
+        for (uint32_t rest = winners; rest; rest &= rest - 1) {
+            writeName(out, gameState, gameState.players[nextSeat(rest, 0)]) << ((rest & (rest - 1)) ? ", " : "");
+        }
+        out << " with " << best.description() << "!\n";
+    }
+
+    awardPot(strength);
 }
 
-void BloodGambleGame::awardPot(int winnerId) {
-    if (winnerId == -1 || gameState.pot == 0) return;
-    
-    gameState.players[winnerId].hp += gameState.pot;
-    
-    std::cout << "\n" << (gameState.players[winnerId].isHuman ? "YOU" : ("AI " + std::to_string(winnerId)));
-    std::cout << " wins " << gameState.pot << " HP!\n";
-    
-    bool playerWon = gameState.players[winnerId].isHuman;
+void BloodGambleGame::awardPot(const uint32_t* strength) {
+    if (gameState.inHandMask == 0 || gameState.pot == 0) return;
+
+    int seats = static_cast<int>(gameState.players.size());
+    int oddChipSeat = (gameState.dealerIndex + 1) % seats;
+    PotSplit split = splitPots(gameState.contributed.data(), seats, gameState.inHandMask, strength, oddChipSeat);
+    int count = seatCount(split.winners);
+    lastRound.winnerId = split.winners ? nextSeat(split.winners, oddChipSeat) : -1;
+    lastRound.pot = gameState.pot;
+    lastRound.winnerMask = split.winners;
+    std::copy(split.won, split.won + seats, lastRound.won);
+
+    Renderer& out = gameState.renderer;
+    bool playerWon = false;
+    for (int seat = 0; seat < seats; seat++) {
+        if (split.refunded[seat] > 0) {
+            gameState.record(RecordType::REFUND, seat, 0, 0, split.refunded[seat]);
+            gameState.players[seat].hp += split.refunded[seat];
+            writeName(out << "\n", gameState, gameState.players[seat]) << " takes back " << split.refunded[seat]
+                << " uncalled HP.";
+        }
+    }
+    for (uint32_t rest = split.winners; rest; rest &= rest - 1) {
+        int seat = nextSeat(rest, 0);
+        int amount = split.won[seat];
+        gameState.record(RecordType::AWARD, seat, 0, count > 1, amount);
+        gameState.players[seat].hp += amount;
+        playerWon = playerWon || gameState.players[seat].isHuman;
+        writeName(out << "\n", gameState, gameState.players[seat]) << " wins " << amount << " HP!";
+    }
+    out << "\n";
+
     gameState.updateVigilanceAfterRound(playerWon);
-    
+
     gameState.pot = 0;
     std::fill(gameState.currentBets.begin(), gameState.currentBets.end(), 0);
-    
+
     // Advance dealer
     do {
-        gameState.dealerIndex = (gameState.dealerIndex + 1) % 4;
+        gameState.dealerIndex = (gameState.dealerIndex + 1) % seats;
     } while (gameState.players[gameState.dealerIndex].hp <= 0);
-    
-    std::cout << "\nPress Enter to continue...";
-    std::cin.ignore();
-    std::cin.get();
+
+    if (!headless) {
+        out << "\nPress Enter to continue...";
+        out.flush();
+        std::cin.ignore();
+        std::cin.get();
+    }
 }
 
 void BloodGambleGame::endGame() {
-    std::cout << "\n" << std::string(50, '=') << "\n";
-    std::cout << "GAME OVER\n";
-    std::cout << std::string(50, '=') << "\n";
-    
-    if (gameState.players[0].hp <= 0) {
-        std::cout << "You have been eliminated! The Hell Soldiers have won.\n";
-    } else {
-        std::cout << "Congratulations! You have defeated all Hell Soldiers!\n";
-        std::cout << "Your final HP: " << gameState.players[0].hp << "\n";
+    Renderer& out = gameState.renderer;
+    out << "\n";
+    out.rule() << "\n";
+    out << "GAME OVER\n";
+    out.rule() << "\n";
+
+    const Player* survivor = nullptr;   // Human seats first
+    for (const auto& player : gameState.players) {
+        if (player.hp > 0 && (!survivor || (player.isHuman && !survivor->isHuman))) survivor = &player;
     }
-    
-    std::cout << "\nFinal vigilance level: " << std::fixed << std::setprecision(2) 
-              << gameState.vigilance << "\n";
-    std::cout << "Rounds played: " << gameState.roundNumber << "\n";
-}
\ No newline at end of file
+
+    if (gameState.humanMask != 0 && (!survivor || !survivor->isHuman)) {
+        out << "You have been eliminated! The Hell Soldiers have won.\n";
+    } else if (survivor && survivor->isHuman) {
+        out << "Congratulations! You have defeated all Hell Soldiers!\n";
+        writeName(out, gameState, *survivor) << " final HP: " << survivor->hp << "\n";
+    } else if (survivor) {
+        writeName(out, gameState, *survivor) << " is the last seat standing with " << survivor->hp << " HP.\n";
+    }
+
+    out << "\nFinal vigilance level: ";
+    out.fixed(gameState.vigilance, 2) << "\n";
+    out << "Rounds played: " << gameState.roundNumber << "\n";
+    out.flush();
+}
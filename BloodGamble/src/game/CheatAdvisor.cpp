@@ -0,0 +1,161 @@
+#include "../../include/game/CheatAdvisor.h"
+#include "../../include/game/BloodGambleGame.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cmath>
+
+namespace {
+
+const uint64_t BLOCK_ROLLOUTS = 16;
+const int OPTIONS = CHEAT_COUNT + 1;   // Every cheat, then playing on without one
+
+struct BlockResult {
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    uint64_t detected = 0;
+};
+
+// New cards for everything the user cannot see: the deck order and the other
+// hands still in play. The user's hole cards and the board stay.
+void redealHidden(GameState& game, int userSeat, uint64_t seed) {
+    game.deck = Deck(seed, 0);
+    for (const Card& card : game.players[userSeat].hand) game.deck.remove(card);
+    for (const Card& card : game.board) game.deck.remove(card);
+
+    for (uint32_t rest = game.inHandMask & ~seatBit(userSeat); rest; rest &= rest - 1) {
+        Card first = game.deck.draw();
+        game.players[nextSeat(rest, 0)].setHand(first, game.deck.draw());
+    }
+    game.rng = Rng(seed >> 32, 1);
+}
+
+// HP the user gains or loses from now to the end of the round
+int rollout(const GameState& state, int userSeat, int targetId, int option, uint64_t seed, bool& detected) {
+    BloodGambleGame game(state);
+    GameState& copy = game.getState();
+    redealHidden(copy, userSeat, seed);
+
+    int hpBefore = copy.players[userSeat].hp;
+    detected = false;
+    if (option < CHEAT_COUNT) {
+        copy.executeCheat(static_cast<CheatId>(option), targetId, userSeat, &detected);
+    }
+    game.finishRound();
+    return copy.players[userSeat].hp - hpBefore;
+}
+
+// Rollout k uses the same seed for every option, so all options see the same
+// hidden cards and detection roll and their differences carry less noise
+BlockResult runBlock(const GameState& state, int userSeat, int targetId, int option, uint64_t seed, uint64_t block) {
+    BlockResult result;
+    for (uint64_t i = 0; i < BLOCK_ROLLOUTS; i++) {
+        bool detected;
+        double delta = rollout(state, userSeat, targetId, option,
+                               splitMix64(seed ^ splitMix64(block * BLOCK_ROLLOUTS + i)), detected);
+        result.sum += delta;
+        result.sumSquares += delta * delta;
+        result.detected += detected;
+    }
+    return result;
+}
+
+} // namespace
+
+CheatAdvice CheatAdvisor::advise(const GameState& state, int userSeat, int targetId, const Settings& settings) {
+    CheatAdvice advice;
+    advice.userSeat = userSeat;
+    advice.target = targetId;
+    if (userSeat < 0 || userSeat >= static_cast<int>(state.players.size())) return advice;
+
+    std::array<double, CHEAT_COUNT> detectProbs = state.computeDetectionProbabilities(targetId, state.stage);
+    bool ready[OPTIONS];
+    for (int id = 0; id < CHEAT_COUNT; id++) {
+        const Player& user = state.players[userSeat];
+        ready[id] = user.isHuman && user.canUseCheat(static_cast<CheatId>(id));
+        advice.cheats[id].ready = ready[id];
+        advice.cheats[id].detectProbability = detectProbs[id];
+    }
+    ready[CHEAT_COUNT] = true;
+    advice.noCheat.ready = true;
+
+    using Clock = std::chrono::steady_clock;
+    const bool hasDeadline = settings.timeBudget.count() > 0;
+    const Clock::time_point deadline = Clock::now() + settings.timeBudget;
+
+    // Job j is block j / OPTIONS of option j % OPTIONS, so the options advance together
+    const uint64_t blocksPerOption = std::max<uint64_t>(1, (settings.maxSamples + BLOCK_ROLLOUTS - 1) / BLOCK_ROLLOUTS);
+    const uint64_t totalJobs = blocksPerOption * OPTIONS;
+    std::vector<BlockResult> results(totalJobs);
+    std::unique_ptr<std::atomic<bool>[]> done(new std::atomic<bool>[totalJobs]);
+    for (uint64_t i = 0; i < totalJobs; i++) done[i].store(false, std::memory_order_relaxed);
+    std::atomic<uint64_t> nextJob{0};
+    std::atomic<bool> stop{false};
+
+    auto work = [&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            uint64_t job = nextJob.fetch_add(1, std::memory_order_relaxed);
+            if (job >= totalJobs) break;
+            int option = static_cast<int>(job % OPTIONS);
+            if (!ready[option]) continue;
+            results[job] = runBlock(state, userSeat, targetId, option, settings.seed, job / OPTIONS);
+            done[job].store(true, std::memory_order_release);
+            if (hasDeadline && Clock::now() >= deadline) stop.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < settings.threads; i++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (int option = 0; option < OPTIONS; option++) {
+        CheatOutcome& outcome = option < CHEAT_COUNT ? advice.cheats[option] : advice.noCheat;
+        double sum = 0.0, sumSquares = 0.0;
+        for (uint64_t job = option; job < totalJobs; job += OPTIONS) {
+            if (!done[job].load(std::memory_order_acquire)) continue;
+            sum += results[job].sum;
+            sumSquares += results[job].sumSquares;
+            outcome.detected += results[job].detected;
+            outcome.samples += BLOCK_ROLLOUTS;
+        }
+        if (outcome.samples == 0) continue;
+        outcome.meanHpDelta = sum / outcome.samples;
+        outcome.variance = std::max(0.0, sumSquares / outcome.samples - outcome.meanHpDelta * outcome.meanHpDelta);
+    }
+    return advice;
+}
+
+void CheatAdvisor::report(const CheatAdvice& advice, Renderer& out) {
+    const CheatOutcome& base = advice.noCheat;
+    out << "\n=== CHEAT ADVISOR ===\n";
+    out << "HP change to the end of this round, " << base.samples << " rollouts per option";
+    if (advice.target >= 0) out << ", target " << advice.target;
+    out << "\nNo cheat: ";
+    out.fixed(base.meanHpDelta, 2) << " HP (sd ";
+    out.fixed(std::sqrt(base.variance), 1) << ")\n";
+
+    for (int id = 0; id < CHEAT_COUNT; id++) {
+        const CheatOutcome& cheat = advice.cheats[id];
+        out << CheatSystem::getCheatById(id)->name << ": ";
+        if (!cheat.ready) {
+            out << "unavailable\n";
+            continue;
+        }
+        if (cheat.samples == 0) {
+            out << "no rollouts in time\n";
+            continue;
+        }
+        out.fixed(cheat.meanHpDelta, 2) << " HP (";
+        out << (cheat.meanHpDelta >= base.meanHpDelta ? "+" : "");
+        out.fixed(cheat.meanHpDelta - base.meanHpDelta, 2) << " vs no cheat, sd ";
+        out.fixed(std::sqrt(cheat.variance), 1) << ", detected ";
+        out.fixed(100.0 * cheat.detected / cheat.samples, 1) << "%)\n";
+    }
+    out << "Information cheats only show their cost here; the rollouts cannot use what they reveal.\n";
+}
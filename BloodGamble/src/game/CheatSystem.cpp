@@ -1,82 +1,111 @@
 #include "../../include/game/CheatSystem.h"
 #include "../../include/game/GameState.h"
-#include <iostream>
-#include <iomanip>
+#include "../../include/ai/EquityEnumerator.h"
+#include <thread>
 
-CheatType::CheatType(const std::string& n, const std::string& desc, double bd, DetectionSeverity sev, int hp, int cd)
-    : name(n), description(desc), baseDetect(bd), severity(sev), hpPenalty(hp), cooldown(cd) {}
+namespace {
 
-CheatSystem::CheatSystem() {
-    initializeCheatTypes();
+void swapHands(Player* user, Player* /*target*/, GameState* game) {
+    Card first = game->getDeck().draw();
+    user->setHand(first, game->getDeck().draw());
 }
 
-void CheatSystem::initializeCheatTypes() {
-    cheatTypes.emplace("SwapHands", CheatType("SwapHands", 
-        "Swap your hole cards with 2 random cards from deck", 
-        0.10, DetectionSeverity::MAJOR, 10, 4));
-    cheatTypes.at("SwapHands").effect = [](Player* user, Player* target, GameState* game) {
-        auto newCards = game->getDeck().draw(2);
-        user->hand = newCards;
-    };
-    cheatTypes.emplace("PeekOpponentHole", CheatType("PeekOpponentHole",
-        "Peek at an opponent's hole cards",
-        0.06, DetectionSeverity::SMALL, 5, 2));
-    cheatTypes.at("PeekOpponentHole").effect = [](Player* user, Player* target, GameState* game) {
-        if (target && !target->isHuman) {
-            std::cout << "\n[CHEAT SUCCESS] " << target->hand[0].toString() 
-                     << " " << target->hand[1].toString() << " (AI " << target->id << ")\n";
-        }
-    };
-    cheatTypes.emplace("MuckSwap", CheatType("MuckSwap",
-        "Replace next board card with a random card",
-        0.18, DetectionSeverity::MAJOR, 15, 5));
-    cheatTypes.at("MuckSwap").effect = [](Player* user, Player* target, GameState* game) {
-        if (!game->getDeck().empty()) {
-            game->getDeck().draw(); // Remove top card
-            game->getDeck().shuffle(); // Shuffle to randomize next card
-        }
-    };
-    cheatTypes.emplace("ForceFold", CheatType("ForceFold",
-        "Increase target AI's fold probability this round",
-        0.12, DetectionSeverity::SMALL, 8, 4));
-    cheatTypes.at("ForceFold").effect = [](Player* user, Player* target, GameState* game) {
-        if (target && !target->isHuman) {
-            target->tightness = std::min(1.0, target->tightness + 0.3);
-            std::cout << "\n[CHEAT SUCCESS] AI " << target->id << " feels tilted!\n";
-        }
-    };
-    cheatTypes.emplace("StackPeek", CheatType("StackPeek",
-        "Reveal AI's HP and behavioral tendencies",
-        0.05, DetectionSeverity::SMALL, 4, 3));
-    cheatTypes.at("StackPeek").effect = [](Player* user, Player* target, GameState* game) {
-        if (target && !target->isHuman) {
-            std::cout << "\n[CHEAT SUCCESS] AI " << target->id << " - HP: " << target->hp 
-                     << ", Aggression: " << std::fixed << std::setprecision(2) << target->aggression
-                     << ", Tightness: " << target->tightness 
-                     << ", Suspicion: " << target->suspicion << "\n";
-        }
-    };
-    cheatTypes.emplace("CardMarking", CheatType("CardMarking",
-        "Slightly bias next card draw in your favor",
-        0.15, DetectionSeverity::MAJOR, 12, 6));
-    cheatTypes.at("CardMarking").effect = [](Player* user, Player* target, GameState* game) {
-        game->getDeck().shuffle();
-        std::cout << "\n[CHEAT SUCCESS] Deck shuffled in your favor!\n";
-    };
-    cheatTypes.emplace("BluffBoost", CheatType("BluffBoost",
-        "Make AIs less likely to call your bets this round",
-        0.08, DetectionSeverity::SMALL, 6, 3));
-    cheatTypes.at("BluffBoost").effect = [](Player* user, Player* target, GameState* game) {
-        for (auto& player : game->getPlayers()) {
-            if (!player.isHuman) {
-                player.tightness = std::min(1.0, player.tightness + 0.2);
-            }
+void peekOpponentHole(Player* user, Player* target, GameState* game) {
+    // Display only, so headless copies (replays, advisor rollouts) skip the enumeration
+    Renderer& out = game->renderer;
+    if (target && !target->isHuman && !out.isNullSink()) {
+        out << "\n[CHEAT SUCCESS] " << target->hand[0].toString() 
+            << " " << target->hand[1].toString() << " (AI " << target->id << ")\n";
+        
+        // Both hands are known now, so the heads-up odds can be enumerated exactly
+        int threads = std::max(1u, std::thread::hardware_concurrency());
+        ExactEquity odds = EquityEnumerator::enumerate({user->handMask, target->handMask}, game->boardMask, threads);
+        const SeatOutcome& you = odds.seats[0];
+        out << "Your equity vs AI " << target->id << ": ";
+        out.fixed(odds.equity(0) * 100, 1) << "% (win " << you.wins << ", tie " << you.ties
+            << ", lose " << you.losses << " of " << odds.deals << " boards)\n";
+    }
+}
+
+void muckSwap(Player* /*user*/, Player* /*target*/, GameState* game) {
+    if (!game->getDeck().empty()) {
+        game->getDeck().draw(); // Remove top card
+        game->getDeck().shuffleRemaining(); // Shuffle to randomize next card
+    }
+}
+
+void forceFold(Player* /*user*/, Player* target, GameState* game) {
+    if (target && !target->isHuman) {
+        target->tightness = std::min(1.0, target->tightness + 0.3);
+        game->renderer << "\n[CHEAT SUCCESS] AI " << target->id << " feels tilted!\n";
+    }
+}
+
+void stackPeek(Player* /*user*/, Player* target, GameState* game) {
+    if (target && !target->isHuman) {
+        Renderer& out = game->renderer;
+        out << "\n[CHEAT SUCCESS] AI " << target->id << " - HP: " << target->hp << ", Aggression: ";
+        out.fixed(target->aggression, 2) << ", Tightness: ";
+        out.fixed(target->tightness, 2) << ", Suspicion: ";
+        out.fixed(target->suspicion, 2) << "\n";
+    }
+}
+
+void cardMarking(Player* /*user*/, Player* /*target*/, GameState* game) {
+    game->getDeck().shuffleRemaining();
+    game->renderer << "\n[CHEAT SUCCESS] Deck shuffled in your favor!\n";
+}
+
+void bluffBoost(Player* /*user*/, Player* /*target*/, GameState* game) {
+    for (auto& player : game->getPlayers()) {
+        if (!player.isHuman) {
+            player.tightness = std::min(1.0, player.tightness + 0.2);
         }
-        std::cout << "\n[CHEAT SUCCESS] All AIs become more cautious!\n";
-    };
+    }
+    game->renderer << "\n[CHEAT SUCCESS] All AIs become more cautious!\n";
+}
+
+constexpr CheatType CHEATS[CHEAT_COUNT] = {
+    {"SwapHands", "Swap your hole cards with 2 random cards from deck",
+     0.10, DetectionSeverity::MAJOR, 10, 4, CheatId::SWAP_HANDS, swapHands},
+    {"PeekOpponentHole", "Peek at an opponent's hole cards",
+     0.06, DetectionSeverity::SMALL, 5, 2, CheatId::PEEK_OPPONENT_HOLE, peekOpponentHole},
+    {"MuckSwap", "Replace next board card with a random card",
+     0.18, DetectionSeverity::MAJOR, 15, 5, CheatId::MUCK_SWAP, muckSwap},
+    {"ForceFold", "Increase target AI's fold probability this round",
+     0.12, DetectionSeverity::SMALL, 8, 4, CheatId::FORCE_FOLD, forceFold},
+    {"StackPeek", "Reveal AI's HP and behavioral tendencies",
+     0.05, DetectionSeverity::SMALL, 4, 3, CheatId::STACK_PEEK, stackPeek},
+    {"CardMarking", "Slightly bias next card draw in your favor",
+     0.15, DetectionSeverity::MAJOR, 12, 6, CheatId::CARD_MARKING, cardMarking},
+    {"BluffBoost", "Make AIs less likely to call your bets this round",
+     0.08, DetectionSeverity::SMALL, 6, 3, CheatId::BLUFF_BOOST, bluffBoost},
+};
+
+constexpr bool idsMatchSlots() {
+    for (int i = 0; i < CHEAT_COUNT; i++) {
+        if (static_cast<int>(CHEATS[i].id) != i) return false;
+    }
+    return true;
+}
+static_assert(idsMatchSlots(), "CHEATS must be listed in CheatId order");
+
+} // namespace
+
+const CheatType& CheatSystem::get(CheatId id) {
+    return CHEATS[index(id)];
+}
+
+const CheatType* CheatSystem::getCheatById(int id) {
+    return id >= 0 && id < CHEAT_COUNT ? &CHEATS[id] : nullptr;
 }
 
-const CheatType* CheatSystem::getCheat(const std::string& name) const {
-    auto it = cheatTypes.find(name);
-    return it != cheatTypes.end() ? &it->second : nullptr;
-}
\ No newline at end of file
+bool CheatSystem::parse(const std::string& name, CheatId& id) {
+    for (const CheatType& cheat : CHEATS) {
+        if (name == cheat.name) {
+            id = cheat.id;
+            return true;
+        }
+    }
+    return false;
+}
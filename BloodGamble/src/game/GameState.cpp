@@ -1,27 +1,92 @@
 #include "../../include/game/GameState.h"
-#include <iostream>
-#include <iomanip>
 #include <algorithm>
+#include <stdexcept>
+#include <climits>
 
-GameState::GameState(unsigned int seed)
-    : deck(seed), pot(0), dealerIndex(0), stage(GameStage::PRE_FLOP),
-      vigilance(0.0), roundNumber(0), rng(seed) {
-    
-    // Initialize players (1 human + 3 AI)
-    players.emplace_back(0, true, HP_PLAYER_INIT);   // Human player
-    players.emplace_back(1, false, HP_AI_INIT);      // AI 1
-    players.emplace_back(2, false, HP_AI_INIT);      // AI 2
-    players.emplace_back(3, false, HP_AI_INIT);      // AI 3
-    
-    currentBets.resize(4, 0);
+namespace {
+
+uint64_t tableSeed(uint64_t master, uint64_t stream) {
+    return stream == 0 ? master : streamSeed(master, stream);
 }
 
-double GameState::computeDetectionProbability(const std::string& cheatName, int targetId, GameStage currentStage) {
-    const CheatType* cheat = cheatSystem.getCheat(cheatName);
-    if (!cheat) return 1.0;
+} // namespace
+
+GameState::GameState(uint64_t seed, const TableSetup& table, uint64_t stream)
+    : deck(tableSeed(seed, stream), 0), pot(0), dealerIndex(0), inHandMask(0), allInMask(0), pendingMask(0),
+      stage(GameStage::PRE_FLOP), vigilance(0.0), roundNumber(0), seed(tableSeed(seed, stream)),
+      rng(tableSeed(seed, stream), 1), history(nullptr) {
+    if (table.seats < MIN_SEATS || table.seats > MAX_SEATS) {
+        throw std::invalid_argument("Table needs between 2 and 10 seats");
+    }
+    humanMask = table.humanMask & ((1u << table.seats) - 1);
     
-    double baseDetect = cheat->baseDetect;
+    players.reserve(table.seats);
+    for (int seat = 0; seat < table.seats; seat++) {
+        bool human = (humanMask & seatBit(seat)) != 0;
+        players.emplace_back(seat, human, human ? HP_PLAYER_INIT : HP_AI_INIT);
+    }
     
+    currentBets.resize(table.seats, 0);
+    contributed.resize(table.seats, 0);
+    board.reserve(5);
+}
+
+PotSplit splitPots(const int* contributed, int seats, uint32_t contenders, const uint32_t* strength, int oddChipSeat) {
+    PotSplit split;
+    int paid = 0;   // Height of the layers already paid out
+    while (contenders) {
+        int level = INT_MAX;
+        for (uint32_t rest = contenders; rest; rest &= rest - 1) {
+            level = std::min(level, contributed[nextSeat(rest, 0)]);
+        }
+        uint32_t capped = 0;   // Contenders whose whole stake this layer pays out
+        for (uint32_t rest = contenders; rest; rest &= rest - 1) {
+            int seat = nextSeat(rest, 0);
+            if (contributed[seat] == level) capped |= seatBit(seat);
+        }
+        bool top = capped == contenders;   // The last layer also takes everything folded seats put above it
+
+        int layer = 0;
+        uint32_t payers = 0;
+        for (int seat = 0; seat < seats; seat++) {
+            int upTo = top ? contributed[seat] : std::min(contributed[seat], level);
+            int part = upTo - std::min(contributed[seat], paid);
+            if (part > 0) {
+                layer += part;
+                payers |= seatBit(seat);
+            }
+        }
+
+        if (layer > 0 && seatCount(payers) == 1 && (payers & contenders)) {
+            split.refunded[nextSeat(payers, 0)] += layer;
+        } else if (layer > 0) {
+            uint32_t best = 0;
+            uint32_t winners = 0;
+            for (uint32_t rest = contenders; rest; rest &= rest - 1) {
+                int seat = nextSeat(rest, 0);
+                uint32_t value = strength ? strength[seat] : 0;
+                if (winners == 0 || value > best) {
+                    best = value;
+                    winners = seatBit(seat);
+                } else if (value == best) {
+                    winners |= seatBit(seat);
+                }
+            }
+            int share = layer / seatCount(winners);
+            for (uint32_t rest = winners; rest; rest &= rest - 1) {
+                split.won[nextSeat(rest, 0)] += share;
+            }
+            split.won[nextSeat(winners, oddChipSeat)] += layer - share * seatCount(winners);
+            split.winners |= winners;
+        }
+
+        contenders &= ~capped;
+        paid = level;
+    }
+    return split;
+}
+
+double GameState::detectionScale(int targetId, GameStage currentStage) const {
     // Stage factor
     double stageFactor = 1.0;
     switch (currentStage) {
@@ -38,65 +103,66 @@ double GameState::computeDetectionProbability(const std::string& cheatName, int
         targetSuspicion = players[targetId].suspicion;
     }
     
-    // Repeat penalty
-    double repeatPenalty = 0.0;
-    int recentUses = 0;
-    for (const auto& recentCheat : recentCheats) {
-        if (recentCheat == cheatName) recentUses++;
-    }
-    repeatPenalty = recentUses * CHEAT_REPEAT_PENALTY;
-    
-    double finalProb = baseDetect * (1 + vigilance) * (1 + targetSuspicion) * stageFactor + repeatPenalty;
+    return (1 + vigilance) * (1 + targetSuspicion) * stageFactor;
+}
+
+double GameState::computeDetectionProbability(CheatId cheat, int targetId, GameStage currentStage) const {
+    double repeatPenalty = recentCheats.count(cheat) * CHEAT_REPEAT_PENALTY;
+    double finalProb = CheatSystem::get(cheat).baseDetect * detectionScale(targetId, currentStage) + repeatPenalty;
     return std::clamp(finalProb, 0.0, 0.95);
 }
 
-bool GameState::executeCheat(const std::string& cheatName, int targetId) {
-    const CheatType* cheat = cheatSystem.getCheat(cheatName);
-    if (!cheat) {
-        std::cout << "Unknown cheat: " << cheatName << "\n";
-        return false;
-    }
-    
-    // Find human player
-    Player* humanPlayer = nullptr;
-    for (auto& p : players) {
-        if (p.isHuman) {
-            humanPlayer = &p;
-            break;
-        }
+std::array<double, CHEAT_COUNT> GameState::computeDetectionProbabilities(int targetId, GameStage currentStage) const {
+    double scale = detectionScale(targetId, currentStage);
+    std::array<double, CHEAT_COUNT> probs;
+    for (int id = 0; id < CHEAT_COUNT; id++) {
+        CheatId cheat = static_cast<CheatId>(id);
+        double finalProb = CheatSystem::get(cheat).baseDetect * scale + recentCheats.count(cheat) * CHEAT_REPEAT_PENALTY;
+        probs[id] = std::clamp(finalProb, 0.0, 0.95);
     }
-    
-    if (!humanPlayer) {
-        std::cout << "No human player found!\n";
+    return probs;
+}
+
+bool GameState::cheatReady(CheatId cheat, int userSeat) {
+    if (userSeat < 0 || userSeat >= static_cast<int>(players.size()) || !players[userSeat].isHuman) {
+        renderer << "Only human seats can cheat!\n";
         return false;
     }
     
-    if (!humanPlayer->canUseCheat(cheatName)) {
-        std::cout << "Cheat is on cooldown!\n";
+    if (!players[userSeat].canUseCheat(cheat)) {
+        renderer << "Cheat is on cooldown!\n";
         return false;
     }
+    return true;
+}
+
+bool GameState::executeCheat(CheatId id, int targetId, int userSeat, bool* detectedOut) {
+    if (!cheatReady(id, userSeat)) return false;
     
-    double detectProb = computeDetectionProbability(cheatName, targetId, stage);
-    
-    std::cout << "\nEstimated detection chance: " << std::fixed << std::setprecision(1) 
-              << (detectProb * 100) << "% (vigilance=" << std::setprecision(2) 
-              << vigilance << ")\n";
+    const CheatType* cheat = &CheatSystem::get(id);
+    Player* humanPlayer = &players[userSeat];
     
-    std::cout << "Proceed with cheat? (y/n): ";
-    std::string confirm;
-    std::cin >> confirm;
-    if (confirm != "y" && confirm != "Y") {
-        return false;
-    }
+    double detectProb = computeDetectionProbability(id, targetId, stage);
     
     // Roll for detection
-    std::uniform_real_distribution<double> dis(0.0, 1.0);
-    bool detected = dis(rng) < detectProb;
+    double roll = uniform01(rng);
+    bool detected = roll < detectProb;
+    record(RecordType::CHEAT, humanPlayer->id, CheatSystem::index(id), detected, targetId, static_cast<uint32_t>(roll * 4294967296.0));
+    humanPlayer->stats.onCheat(detected);
+    if (detectedOut) *detectedOut = detected;
     
     if (detected) {
-        std::cout << "\n*** ALERT: Your cheat '" << cheatName 
+        renderer << "\n*** ALERT: Your cheat '" << cheat->name 
                  << "' was detected! You lose " << cheat->hpPenalty << " HP. ***\n";
         humanPlayer->hp -= cheat->hpPenalty;
+        if (humanPlayer->hp <= 0) {
+            // Out of the hand, forfeiting what it already put in
+            humanPlayer->hp = 0;
+            humanPlayer->folded = true;
+            inHandMask &= ~seatBit(userSeat);
+            pendingMask &= ~seatBit(userSeat);
+            renderer << "You have no HP left and drop out of the hand.\n";
+        }
         vigilance = std::min(MAX_VIGILANCE, vigilance + VIGILANCE_INCREMENT_PER_DETECT);
         
         // Increase suspicion of all AIs
@@ -106,7 +172,7 @@ bool GameState::executeCheat(const std::string& cheatName, int targetId) {
             }
         }
     } else {
-        std::cout << "\n[CHEAT SUCCESS] Using " << cheatName << "...\n";
+        renderer << "\n[CHEAT SUCCESS] Using " << cheat->name << "...\n";
         
         // Execute cheat effect
         Player* target = nullptr;
@@ -118,47 +184,45 @@ bool GameState::executeCheat(const std::string& cheatName, int targetId) {
     }
     
     // Set cooldown
-    humanPlayer->cheatCooldowns[cheatName] = cheat->cooldown;
+    humanPlayer->cheatCooldowns[CheatSystem::index(id)] = static_cast<uint8_t>(cheat->cooldown);
     
-    // Add to recent cheats list (keep last 5)
-    recentCheats.push_back(cheatName);
-    if (recentCheats.size() > 5) {
-        recentCheats.erase(recentCheats.begin());
-    }
+    recentCheats.push(id);
     
     return true;
 }
 
-void GameState::showCheatList() {
-    // Find human player
-    const Player* humanPlayer = nullptr;
-    for (const auto& p : players) {
-        if (p.isHuman) {
-            humanPlayer = &p;
-            break;
-        }
-    }
+void GameState::showCheatList(int userSeat) {
+    if (userSeat < 0 || userSeat >= static_cast<int>(players.size())) return;
+    const Player* humanPlayer = &players[userSeat];
     
-    if (!humanPlayer) return;
+    renderer << "\n=== AVAILABLE CHEATS ===\n";
+    std::array<double, CHEAT_COUNT> detectProbs = computeDetectionProbabilities(-1, stage);
     
-    std::cout << "\n=== AVAILABLE CHEATS ===\n";
-    
-    for (const auto& pair : cheatSystem.getCheatTypes()) {
-        const CheatType& cheat = pair.second;
-        bool onCooldown = !humanPlayer->canUseCheat(cheat.name);
+    for (int id = 0; id < CHEAT_COUNT; id++) {
+        const CheatType& cheat = *CheatSystem::getCheatById(id);
+        bool onCooldown = !humanPlayer->canUseCheat(cheat.id);
         
-        std::cout << cheat.name;
+        renderer << cheat.name;
         if (onCooldown) {
-            std::cout << " (COOLDOWN: " << humanPlayer->cheatCooldowns.at(cheat.name) << " rounds)";
+            renderer << " (COOLDOWN: " << static_cast<int>(humanPlayer->cheatCooldowns[id]) << " rounds)";
         } else {
-            double detectProb = computeDetectionProbability(cheat.name, -1, stage);
-            std::cout << " (Detection: " << std::fixed << std::setprecision(1) 
-                     << (detectProb * 100) << "%)";
+            renderer << " (Detection: ";
+            renderer.fixed(detectProbs[id] * 100, 1) << "%)";
         }
-        std::cout << "\n  " << cheat.description << "\n\n";
+        renderer << "\n  " << cheat.description << "\n\n";
     }
 }
 
+void GameState::addBoardCard(const Card& card) {
+    board.push_back(card);
+    boardMask.add(card);
+}
+
+void GameState::clearBoard() {
+    board.clear();
+    boardMask = CardSet();
+}
+
 void GameState::updateVigilanceAfterRound(bool playerWon) {
     if (playerWon) {
         vigilance = std::min(MAX_VIGILANCE, vigilance + VIGILANCE_INCREMENT_PER_WIN);
@@ -172,71 +236,71 @@ void GameState::updateVigilanceAfterRound(bool playerWon) {
     }
 }
 
-std::vector<int> GameState::getActivePlayers() {
-    std::vector<int> active;
-    for (size_t i = 0; i < players.size(); i++) {
-        if (players[i].hp > 0 && !players[i].folded) {
-            active.push_back(static_cast<int>(i));
-        }
+SeatList GameState::getActivePlayers() const {
+    SeatList active;
+    for (uint32_t mask = inHandMask; mask; mask &= mask - 1) {
+        active.push(nextSeat(mask, 0));
     }
     return active;
 }
 
+// Over once a single seat is left, or once every human seat is out
 bool GameState::gameOver() {
-    // Find human player
-    int humanHp = 0;
+    int alive = 0;
+    bool humanAlive = false;
     for (const auto& p : players) {
-        if (p.isHuman) {
-            humanHp = p.hp;
-            break;
+        if (p.hp > 0) {
+            alive++;
+            humanAlive = humanAlive || p.isHuman;
         }
     }
     
-    int aiAlive = 0;
-    
-    for (size_t i = 1; i < players.size(); i++) {
-        if (players[i].hp > 0) aiAlive++;
+    return alive < 2 || (humanMask != 0 && !humanAlive);
+}
+
+bool GameState::humanAlive() const {
+    for (const auto& p : players) {
+        if (p.isHuman && p.hp > 0) return true;
     }
-    
-    return humanHp <= 0 || aiAlive == 0;
+    return false;
 }
 
-void GameState::displayStatus() {
-    std::cout << "\n=== GAME STATUS ===\n";
-    std::cout << "Round: " << roundNumber << " | Stage: ";
+void GameState::displayStatus(int viewerSeat) {
+    renderer << "\n=== GAME STATUS ===\n";
+    renderer << "Round: " << roundNumber << " | Stage: ";
     switch (stage) {
-        case GameStage::PRE_FLOP: std::cout << "Pre-flop"; break;
-        case GameStage::FLOP: std::cout << "Flop"; break;
-        case GameStage::TURN: std::cout << "Turn"; break;
-        case GameStage::RIVER: std::cout << "River"; break;
-        case GameStage::SHOWDOWN: std::cout << "Showdown"; break;
+        case GameStage::PRE_FLOP: renderer << "Pre-flop"; break;
+        case GameStage::FLOP: renderer << "Flop"; break;
+        case GameStage::TURN: renderer << "Turn"; break;
+        case GameStage::RIVER: renderer << "River"; break;
+        case GameStage::SHOWDOWN: renderer << "Showdown"; break;
     }
-    std::cout << " | Pot: " << pot << " HP\n";
-    std::cout << "Vigilance: " << std::fixed << std::setprecision(2) << vigilance << "\n";
+    renderer << " | Pot: " << pot << " HP\n";
+    renderer << "Vigilance: ";
+    renderer.fixed(vigilance, 2) << "\n";
     
-    std::cout << "\nPlayers:\n";
+    renderer << "\nPlayers:\n";
     for (const auto& player : players) {
-        std::cout << (player.isHuman ? "YOU" : ("AI " + std::to_string(player.id)));
-        std::cout << " - HP: " << player.hp;
-        if (player.folded) std::cout << " (FOLDED)";
-        if (player.allIn) std::cout << " (ALL-IN)";
-        std::cout << "\n";
+        if (player.id == viewerSeat) renderer << "YOU";
+        else if (player.isHuman) renderer << "PLAYER " << player.id;
+        else renderer << "AI " << player.id;
+        renderer << " - HP: " << player.hp;
+        if (player.folded) renderer << " (FOLDED)";
+        if (player.allIn) renderer << " (ALL-IN)";
+        renderer << "\n";
     }
     
     if (!board.empty()) {
-        std::cout << "\nBoard: ";
+        renderer << "\nBoard: ";
         for (const auto& card : board) {
-            std::cout << card.toStringBoard() << " ";
+            renderer << card.toStringBoard() << " ";
         }
-        std::cout << "\n";
+        renderer << "\n";
     }
     
-    // Find human player and show hand
-    for (const auto& p : players) {
-        if (p.isHuman && !p.hand.empty()) {
-            std::cout << "Your hand: " << p.hand[0].toStringYours() 
-                     << " " << p.hand[1].toStringYours() << "\n";
-            break;
-        }
+    if (viewerSeat >= 0 && viewerSeat < static_cast<int>(players.size()) && !players[viewerSeat].hand.empty()) {
+        const Player& viewer = players[viewerSeat];
+        renderer << "Your hand: " << viewer.hand[0].toStringYours() 
+                 << " " << viewer.hand[1].toStringYours() << "\n";
     }
-}
\ No newline at end of file
+}
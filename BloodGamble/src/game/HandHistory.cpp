@@ -0,0 +1,98 @@
+#include "../../include/game/HandHistory.h"
+#include <cstring>
+
+HandHistory::~HandHistory() {
+    close();
+}
+
+namespace {
+
+bool validHeader(const HistoryFileHeader& header) {
+    return std::memcmp(header.magic, HISTORY_MAGIC, sizeof(header.magic)) == 0
+        && header.version == HISTORY_VERSION && header.recordSize == sizeof(HistoryRecord);
+}
+
+} // namespace
+
+bool HandHistory::openWrite(const std::string& path, bool batch) {
+    close();
+    std::FILE* out = std::fopen(path.c_str(), "a+b");
+    if (!out) return false;
+
+    // Only append to a log of this version; other records after its header would be unreadable
+    std::fseek(out, 0, SEEK_END);
+    if (std::ftell(out) == 0) {
+        HistoryFileHeader header = {};
+        std::memcpy(header.magic, HISTORY_MAGIC, sizeof(header.magic));
+        header.version = HISTORY_VERSION;
+        header.recordSize = sizeof(HistoryRecord);
+        std::fwrite(&header, sizeof(header), 1, out);
+    } else {
+        HistoryFileHeader header;
+        std::rewind(out);
+        if (std::fread(&header, sizeof(header), 1, out) != 1 || !validHeader(header)) {
+            std::fclose(out);
+            return false;
+        }
+    }
+
+    file = out;
+    batched = batch;
+    buffer.reserve(BUFFER_RECORDS);
+    return true;
+}
+
+bool HandHistory::openReplay(const std::string& path) {
+    close();
+    std::FILE* in = std::fopen(path.c_str(), "rb");
+    if (!in) return false;
+
+    HistoryFileHeader header;
+    bool valid = std::fread(&header, sizeof(header), 1, in) == 1 && validHeader(header);
+    if (valid) {
+        HistoryRecord r;
+        while (std::fread(&r, sizeof(r), 1, in) == 1) {
+            expected.push_back(r);
+        }
+    }
+    std::fclose(in);
+
+    replayMode = valid;
+    cursor = 0;
+    mismatchCount = 0;
+    firstMismatch = SIZE_MAX;
+    return valid;
+}
+
+void HandHistory::close() {
+    if (file) {
+        flushBuffer();
+        std::fclose(file);
+        file = nullptr;
+    }
+    buffer.clear();
+    expected.clear();
+    replayMode = false;
+}
+
+void HandHistory::endRound() {
+    if (file && !batched) {
+        flushBuffer();
+        std::fflush(file);
+    }
+}
+
+void HandHistory::flushBuffer() {
+    if (file && !buffer.empty()) {
+        std::fwrite(buffer.data(), sizeof(HistoryRecord), buffer.size(), file);
+    }
+    buffer.clear();
+}
+
+void HandHistory::verify(const HistoryRecord& r) {
+    if (cursor >= expected.size() || !(expected[cursor] == r)) {
+        if (firstMismatch == SIZE_MAX) firstMismatch = cursor;
+        mismatchCount++;
+    }
+    if (cursor < expected.size()) cursor++;
+}
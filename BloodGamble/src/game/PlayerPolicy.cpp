@@ -0,0 +1,139 @@
+#include "../../include/game/PlayerPolicy.h"
+#include "../../include/game/GameState.h"
+#include "../../include/game/CheatAdvisor.h"
+#include "../../include/ai/AIPlayer.h"
+#include <iostream>
+#include <thread>
+
+Decision HumanPolicy::decide(GameState& game, int seat, int callAmount) {
+    Renderer& out = game.renderer;
+    game.displayStatus(seat);
+
+    while (true) {
+        // A detected cheat's penalty can take the last HP; the seat is then out of the hand
+        if (game.players[seat].hp <= 0 || game.players[seat].folded) return {PlayerAction::FOLD, 0};
+
+        out << "\n";
+        out.rule() << "\n";
+        out << "YOUR TURN! Current bet to call: " << callAmount << " HP\n";
+        out.rule() << "\n";
+        out << "1. Fold\n";
+        out << "2. Call (" << callAmount << " HP)\n";
+        out << "3. Raise\n";
+        out << "4. All-in\n";
+        out << "5. Cheat list\n";
+        out << "6. Use cheat\n";
+        out << "7. Status\n";
+        out.rule() << "\n";
+        out << "Choose (1-7): ";
+        out.flush();
+
+        int choice;
+        if (!(std::cin >> choice)) {
+            if (std::cin.eof()) return {PlayerAction::FOLD, 0}; // Input closed
+            std::cin.clear();
+            std::cin.ignore(1024, '\n');
+            choice = 0;
+        }
+
+        switch (choice) {
+            case 1: return {PlayerAction::FOLD, 0};
+            case 2: return {PlayerAction::CALL, 0};
+
+            case 3: {
+                out << "Enter raise amount: ";
+                out.flush();
+                int raiseAmount = 0;
+                std::cin >> raiseAmount;
+                return {PlayerAction::RAISE, raiseAmount};
+            }
+
+            case 4: return {PlayerAction::ALL_IN, 0};
+
+            case 5: { // Cheat list, then rollout estimates against the next opponent in the hand
+                game.showCheatList(seat);
+                uint32_t opponents = game.inHandMask & ~seatBit(seat);
+                CheatAdvisor::Settings settings;
+                settings.threads = std::max(1u, std::thread::hardware_concurrency());
+                // Seeded from the table, not drawn from game.rng, so asking leaves the game unchanged
+                settings.seed = splitMix64(game.seed ^ splitMix64(game.roundNumber * 8 + static_cast<int>(game.stage)));
+                CheatAdvice advice = CheatAdvisor::advise(game, seat, opponents ? nextSeat(opponents, seat + 1) : -1, settings);
+                CheatAdvisor::report(advice, out);
+                break;
+            }
+
+            case 6: { // Use cheat
+                out << "Enter cheat name: ";
+                out.flush();
+                std::string cheatName;
+                std::cin >> cheatName;
+
+                out << "Enter target ID (-1 for no target): ";
+                out.flush();
+                int targetId;
+                std::cin >> targetId;
+
+                CheatId cheat;
+                if (!CheatSystem::parse(cheatName, cheat)) {
+                    out << "Unknown cheat: " << cheatName << "\n";
+                    break;
+                }
+                if (!game.cheatReady(cheat, seat)) break;
+
+                double detectProb = game.computeDetectionProbability(cheat, targetId, game.stage);
+                out << "\nEstimated detection chance: ";
+                out.fixed(detectProb * 100, 1) << "% (vigilance=";
+                out.fixed(game.vigilance, 2) << ")\n";
+                out << "Proceed with cheat? (y/n): ";
+                out.flush();
+
+                std::string confirm;
+                std::cin >> confirm;
+                if (confirm != "y" && confirm != "Y") break;
+
+                if (game.executeCheat(cheat, targetId, seat)) {
+                    out << "Cheat executed. ";
+                }
+                break;
+            }
+
+            case 7: // Status
+                game.displayStatus(seat);
+                break;
+
+            default:
+                out << "Invalid choice. Try again.\n";
+                break;
+        }
+    }
+}
+
+Decision AIPolicy::decide(GameState& game, int seat, int callAmount) {
+    Player& ai = game.players[seat];
+    if (ai.hp <= 0 || ai.folded) return {PlayerAction::FOLD, 0};
+
+    PlayerAction action;
+    int raiseAmount;
+    if (AIPlayer::decideFromStrategy(ai, game, callAmount, action, raiseAmount)) {
+        return {action, raiseAmount};
+    }
+
+    double strength = quick ? AIPlayer::quickStrength(ai, game)
+                            : AIPlayer::estimateStrength(ai, game, EquityBudget::TIMED);
+    action = AIPlayer::decideFromStrength(ai, strength, callAmount, MIN_BET, AIPlayer::readOpponents(ai, game));
+    raiseAmount = action == PlayerAction::RAISE ? AIPlayer::decideRaiseAmount(ai, callAmount, MIN_BET, MAX_BET) : 0;
+    return {action, raiseAmount};
+}
+
+Decision MctsPolicy::decide(GameState& game, int seat, int /*callAmount*/) {
+    const Player& ai = game.players[seat];
+    if (ai.hp <= 0 || ai.folded) return {PlayerAction::FOLD, 0};
+
+    // A fresh seed per spot, so equal budgets sample the same determinizations
+    MctsSearch::Settings spot = settings;
+    spot.seed = splitMix64(settings.seed ^ splitMix64((static_cast<uint64_t>(game.seed) << 32)
+                                                      ^ (static_cast<uint64_t>(game.roundNumber) << 12)
+                                                      ^ (static_cast<uint64_t>(game.pot) << 4) ^ static_cast<uint64_t>(seat)));
+    MctsSearch::Result result = search.search(game, seat, spot);
+    return {result.action, result.raiseAmount};
+}
@@ -0,0 +1,128 @@
+#include "../../include/game/Replay.h"
+#include "../../include/game/BloodGambleGame.h"
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+std::string cardText(uint8_t index) {
+    static const char RANKS[] = "23456789TJQKA";
+    static const char SUITS[] = "HDCS";
+    Card card = Card::fromIndex(index);
+    return {RANKS[static_cast<int>(card.rank) - 2], SUITS[static_cast<int>(card.suit)]};
+}
+
+const char* actionText(uint8_t action) {
+    switch (static_cast<PlayerAction>(action)) {
+        case PlayerAction::FOLD: return "folds";
+        case PlayerAction::CALL: return "calls";
+        case PlayerAction::RAISE: return "raises";
+        case PlayerAction::ALL_IN: return "goes all-in";
+        default: return "passes";
+    }
+}
+
+} // namespace
+
+Decision ReplayPolicy::decide(GameState& game, int seat, int /*callAmount*/) {
+    HandHistory* log = game.history;
+    if (!log) return {PlayerAction::FOLD, 0};
+
+    const HistoryRecord* next;
+    while ((next = log->peek()) && next->type == RecordType::CHEAT && next->seat == seat) {
+        size_t before = log->position();
+        const CheatType* cheat = CheatSystem::getCheatById(next->code);
+        if (cheat) game.executeCheat(cheat->id, next->amount, seat);
+        if (log->position() == before) log->reject(); // Refused here, so the game has diverged
+    }
+
+    next = log->peek();
+    if (next && next->type == RecordType::ACTION && next->seat == seat) {
+        return {static_cast<PlayerAction>(next->code), static_cast<int>(next->value)};
+    }
+    return {PlayerAction::FOLD, 0}; // Diverged; the mismatch is counted when the fold is recorded
+}
+
+ReplayResult Replay::run(HandHistory& log, int game, int round, std::ostream& out) {
+    ReplayResult result;
+    const std::vector<HistoryRecord>& records = log.records();
+
+    while (const HistoryRecord* start = log.peek()) {
+        if (start->type != RecordType::GAME_START || start->seat < MIN_SEATS || start->seat > MAX_SEATS) {
+            log.reject();
+            continue;
+        }
+
+        TableSetup table;
+        table.seats = start->seat;
+        table.humanMask = static_cast<uint32_t>(start->amount);
+        BloodGambleGame replayed(static_cast<uint64_t>(start->round) << 32 | start->value, true, table);
+        GameState& state = replayed.getState();
+        for (size_t seat = 0; seat < state.players.size(); seat++) {
+            replayed.setPolicy(static_cast<int>(seat), std::make_unique<ReplayPolicy>());
+        }
+        replayed.setHistory(&log);
+        bool shown = static_cast<int>(result.games) == game;
+        result.games++;
+
+        const HistoryRecord* next;
+        while ((next = log.peek()) && next->type == RecordType::ROUND_START) {
+            size_t first = log.position();
+            replayed.playRound();
+            result.rounds++;
+
+            if (shown && state.roundNumber == round) {
+                for (size_t i = first; i < log.position(); i++) {
+                    out << std::setw(8) << i << "  " << describe(records[i]) << "\n";
+                }
+            }
+        }
+    }
+
+    result.records = records.size();
+    result.mismatches = log.mismatches();
+    result.firstMismatch = log.firstMismatchIndex();
+    return result;
+}
+
+std::string Replay::describe(const HistoryRecord& r) {
+    std::ostringstream text;
+    text << std::fixed;
+    switch (r.type) {
+        case RecordType::GAME_START:
+            text << "GAME seed " << (static_cast<uint64_t>(r.round) << 32 | r.value) << ", " << static_cast<int>(r.seat) << " players, human mask 0x"
+                 << std::hex << r.amount << std::dec;
+            break;
+        case RecordType::ROUND_START:
+            text << "ROUND " << r.round << ", dealer " << static_cast<int>(r.seat) << ", vigilance "
+                 << std::setprecision(4) << r.value / 1e6;
+            break;
+        case RecordType::DEAL:
+            text << "seat " << static_cast<int>(r.seat) << " dealt " << cardText(r.code) << " " << cardText(r.flag);
+            break;
+        case RecordType::BOARD:
+            text << "board " << static_cast<int>(r.flag) << ": " << cardText(r.code);
+            break;
+        case RecordType::ACTION:
+            text << "seat " << static_cast<int>(r.seat) << " " << actionText(r.code) << ", " << r.amount << " HP";
+            if (static_cast<PlayerAction>(r.code) == PlayerAction::RAISE) text << " (raise " << r.value << ")";
+            break;
+        case RecordType::CHEAT: {
+            const CheatType* cheat = CheatSystem::getCheatById(r.code);
+            text << "seat " << static_cast<int>(r.seat) << " cheats " << (cheat ? cheat->name : "?")
+                 << " on " << r.amount << ", roll " << std::setprecision(4) << r.value / 4294967296.0
+                 << (r.flag ? ", DETECTED" : ", undetected");
+            break;
+        }
+        case RecordType::SHOWDOWN:
+            text << "seat " << static_cast<int>(r.seat) << " shows " << HandValue{r.value}.description();
+            break;
+        case RecordType::AWARD:
+            text << "seat " << static_cast<int>(r.seat) << " wins " << r.amount << " HP" << (r.flag ? " (split pot)" : "");
+            break;
+        case RecordType::REFUND:
+            text << "seat " << static_cast<int>(r.seat) << " takes back " << r.amount << " uncalled HP";
+            break;
+    }
+    return text.str();
+}
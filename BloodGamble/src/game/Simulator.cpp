@@ -0,0 +1,54 @@
+#include "../../include/game/Simulator.h"
+#include "../../include/game/BloodGambleGame.h"
+#include <chrono>
+#include <iomanip>
+#include <memory>
+
+SimulationStats Simulator::run(uint64_t hands, uint64_t seed, HandHistory* history, const TableSetup& table) {
+    SimulationStats stats;
+    auto start = std::chrono::steady_clock::now();
+
+    auto game = std::make_unique<BloodGambleGame>(seed, true, table);
+    if (history) game->setHistory(history);
+    size_t seats = game->getState().players.size();
+    stats.potsWon.assign(seats, 0);
+    stats.hpWon.assign(seats, 0);
+
+    while (stats.hands < hands) {
+        if (game->getState().gameOver()) {
+            if (game->getState().humanAlive()) stats.humanSeatWins++;
+            stats.games++;
+            game = std::make_unique<BloodGambleGame>(seed + stats.games, true, table);
+            if (history) game->setHistory(history);
+        }
+
+        RoundSummary round = game->playRound();
+        stats.hands++;
+        if (round.showdown) stats.showdowns++;
+        for (uint32_t rest = round.winnerMask; rest; rest &= rest - 1) {
+            int seat = nextSeat(rest, 0);
+            stats.potsWon[seat]++;
+            stats.hpWon[seat] += round.shareOf(seat);
+        }
+    }
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+void Simulator::report(const SimulationStats& stats, std::ostream& out) {
+    out << "=== SIMULATION ===\n";
+    out << "Hands: " << stats.hands << " in " << std::fixed << std::setprecision(3) << stats.seconds << " s ("
+        << std::setprecision(0) << stats.handsPerSecond() << " hands/sec)\n";
+    out << "Games finished: " << stats.games << " | Human seats won: " << stats.humanSeatWins << "\n";
+    out << "Showdowns: " << std::setprecision(1)
+        << (stats.hands ? 100.0 * stats.showdowns / stats.hands : 0.0) << "%\n";
+
+    out << "\nSeat  Pots won  Avg pot\n";
+    for (size_t seat = 0; seat < stats.potsWon.size(); seat++) {
+        double avgPot = stats.potsWon[seat] ? static_cast<double>(stats.hpWon[seat]) / stats.potsWon[seat] : 0.0;
+        out << std::setw(4) << seat << "  " << std::setw(7) << std::setprecision(2)
+            << (stats.hands ? 100.0 * stats.potsWon[seat] / stats.hands : 0.0) << "%  "
+            << std::setw(7) << avgPot << "\n";
+    }
+}
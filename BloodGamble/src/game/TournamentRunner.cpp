@@ -0,0 +1,140 @@
+#include "../../include/game/TournamentRunner.h"
+#include "../../include/game/BloodGambleGame.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <thread>
+
+namespace {
+
+// Games handed to a worker per visit of the shared counter
+const uint64_t GAMES_PER_CHUNK = 16;
+
+void addTo(std::vector<uint64_t>& totals, const std::vector<uint64_t>& values) {
+    if (totals.size() < values.size()) totals.resize(values.size(), 0);
+    for (size_t i = 0; i < values.size(); i++) {
+        totals[i] += values[i];
+    }
+}
+
+void addHp(std::vector<uint64_t>& histogram, int hp) {
+    size_t bucket = static_cast<size_t>(std::max(0, hp) / TOURNAMENT_HP_BUCKET);
+    if (histogram.size() <= bucket) histogram.resize(bucket + 1, 0);
+    histogram[bucket]++;
+}
+
+void playGame(uint64_t game, const TournamentRunner::Settings& settings, TournamentResult& result) {
+    BloodGambleGame table(settings.masterSeed, true, settings.table, game);
+    GameState& state = table.getState();
+
+    while (!state.gameOver() && state.roundNumber < settings.maxRounds) {
+        table.playRound();
+        int round = state.roundNumber - 1;
+        if (round < TOURNAMENT_TRACKED_ROUNDS) {
+            result.vigilanceMicros[round] += static_cast<uint64_t>(std::llround(state.vigilance * 1e6));
+            result.vigilanceGames[round]++;
+        }
+    }
+
+    result.games++;
+    result.totalRounds += state.roundNumber;
+    if (!state.gameOver()) result.unfinished++;
+    else if (state.humanAlive()) result.humanSeatWins++;
+    else result.aiWins++;
+
+    for (size_t seat = 0; seat < state.players.size(); seat++) {
+        const Player& player = state.players[seat];
+        if (player.hp > 0) result.survivors[seat]++;
+        addHp(player.isHuman ? result.humanHpHistogram : result.aiHpHistogram, player.hp);
+    }
+}
+
+} // namespace
+
+void TournamentResult::merge(const TournamentResult& other) {
+    games += other.games;
+    humanSeatWins += other.humanSeatWins;
+    aiWins += other.aiWins;
+    unfinished += other.unfinished;
+    totalRounds += other.totalRounds;
+    addTo(survivors, other.survivors);
+    addTo(vigilanceMicros, other.vigilanceMicros);
+    addTo(vigilanceGames, other.vigilanceGames);
+    addTo(humanHpHistogram, other.humanHpHistogram);
+    addTo(aiHpHistogram, other.aiHpHistogram);
+}
+
+TournamentResult TournamentRunner::run(const Settings& settings) {
+    int threads = std::max(1, settings.threads);
+    size_t seats = static_cast<size_t>(settings.table.seats);
+
+    // Each worker fills a result on its own stack; the only shared write is the chunk counter
+    std::vector<TournamentResult> partials(threads);
+    std::atomic<uint64_t> nextChunk{0};
+
+    auto work = [&](int index) {
+        TournamentResult local;
+        local.survivors.assign(seats, 0);
+        local.vigilanceMicros.assign(TOURNAMENT_TRACKED_ROUNDS, 0);
+        local.vigilanceGames.assign(TOURNAMENT_TRACKED_ROUNDS, 0);
+
+        uint64_t first;
+        while ((first = nextChunk.fetch_add(GAMES_PER_CHUNK, std::memory_order_relaxed)) < settings.games) {
+            uint64_t last = std::min(settings.games, first + GAMES_PER_CHUNK);
+            for (uint64_t g = first; g < last; g++) {
+                playGame(g, settings, local);
+            }
+        }
+        partials[index] = std::move(local);
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threads; i++) {
+        workers.emplace_back(work, i);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    TournamentResult result;
+    for (const auto& partial : partials) {
+        result.merge(partial);
+    }
+    return result;
+}
+
+void TournamentRunner::report(const TournamentResult& result, std::ostream& out) {
+    auto percent = [&](uint64_t count) { return result.games ? 100.0 * count / result.games : 0.0; };
+
+    out << "=== TOURNAMENT ===\n";
+    out << "Games: " << result.games << " | Avg rounds: " << std::fixed << std::setprecision(1)
+        << result.averageRounds() << " | Cut off: " << result.unfinished << "\n";
+    out << "Human seats win: " << std::setprecision(2) << percent(result.humanSeatWins) << "% | AI wins: "
+        << percent(result.aiWins) << "%\n";
+
+    out << "\nSeat  Survived\n";
+    for (size_t seat = 0; seat < result.survivors.size(); seat++) {
+        out << std::setw(4) << seat << "  " << std::setw(7) << percent(result.survivors[seat]) << "%\n";
+    }
+
+    out << "\nRound  Games  Avg vigilance\n";
+    for (int round : {1, 5, 10, 25, 50, 100, TOURNAMENT_TRACKED_ROUNDS}) {
+        if (round > static_cast<int>(result.vigilanceGames.size())) break;
+        uint64_t games = result.vigilanceGames[round - 1];
+        double vigilance = games ? result.vigilanceMicros[round - 1] / 1e6 / games : 0.0;
+        out << std::setw(5) << round << "  " << std::setw(5) << games << "  " << std::setprecision(4)
+            << vigilance << "\n";
+    }
+
+    out << "\nFinal HP      Humans   AI seats\n";
+    size_t buckets = std::max(result.humanHpHistogram.size(), result.aiHpHistogram.size());
+    for (size_t bucket = 0; bucket < buckets; bucket++) {
+        uint64_t human = bucket < result.humanHpHistogram.size() ? result.humanHpHistogram[bucket] : 0;
+        uint64_t ai = bucket < result.aiHpHistogram.size() ? result.aiHpHistogram[bucket] : 0;
+        out << std::setw(4) << bucket * TOURNAMENT_HP_BUCKET << "-" << std::setw(4)
+            << (bucket + 1) * TOURNAMENT_HP_BUCKET - 1 << "  " << std::setw(7) << human << "  "
+            << std::setw(9) << ai << "\n";
+    }
+}
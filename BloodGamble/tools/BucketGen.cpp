@@ -0,0 +1,396 @@
+// Offline hand bucketing for the strategy abstraction, mapped with --buckets
+// Usage: BucketGen [output path] [runouts] [opponents] [threads]
+//
+// Every suit-isomorphic flop, turn and river class (HandIndexer) is sampled
+// once: its equity against a random hand on `runouts` random completions of
+// the board, `opponents` random hands each. Flop and turn classes keep the
+// histogram of those equities, river classes (a single runout of
+// runouts * opponents hands) the equity itself.
+//
+// Histograms are clustered by k-means on their cumulative form, where squared
+// distance follows the earth mover's distance between equity distributions;
+// river equities by one-dimensional k-means. Each class weighs as many deals as
+// it stands for, sums are integers so any thread count gives the same buckets,
+// and buckets are renumbered by mean equity so a higher bucket is stronger.
+#include "../include/ai/HandBuckets.h"
+#include "../include/ai/Strategy.h"
+#include "../include/core/HandEvaluator.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+const int HISTOGRAM_BINS = 8;
+const int RIVER_LEVELS = 256;           // River equity in 1/255 steps
+const int KMEANS_MAX_ITERATIONS = 50;
+const double KMEANS_TOLERANCE = 1e-3;   // Stop once less weight than this changes bucket
+const uint32_t BLOCK = 4096;            // Classes per work item and per sampling seed
+const uint64_t SEED = 0xB0C4E7;
+
+struct Settings {
+    int runouts = 16;
+    int opponents = 16;
+    int threads = 1;
+};
+
+// Runs fn(thread, block, first, last) over [0, count) in BLOCK-sized pieces on every thread
+template <typename Fn>
+void parallelBlocks(uint32_t count, int threads, Fn fn) {
+    std::atomic<uint32_t> nextBlock{0};
+    auto work = [&](int thread) {
+        uint32_t block;
+        while ((block = nextBlock.fetch_add(1, std::memory_order_relaxed)) < (count + BLOCK - 1) / BLOCK) {
+            fn(thread, block, block * BLOCK, std::min(count, (block + 1) * BLOCK));
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+        workers.emplace_back(work, t);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Rng(seed, stream) jumps `stream` times, so blocks of a street get their own seeds instead
+Rng blockRng(int boardCards, uint32_t block) {
+    return Rng(splitMix64(SEED + boardCards) ^ splitMix64(block));
+}
+
+// Wins count 2 and ties 1 against `opponents` random hands on a random completion of the board
+class Sampler {
+private:
+    uint8_t deck[Deck::DECK_SIZE];
+    int left = 0;
+    int missing = 0;
+    CardSet hole, board;
+
+public:
+    Sampler(int boardCards, uint32_t index) {
+        HandIndexer::unindex(boardCards, index, hole, board);
+        CardSet rest = CardSet::fullDeck() - hole - board;
+        while (!rest.empty()) deck[left++] = rest.popLowest().index();
+        missing = HandIndexer::MAX_BOARD_CARDS - boardCards;
+    }
+
+    int points(int opponents, Rng& rng) {
+        CardSet full = board;
+        for (int i = 0; i < missing; i++) {
+            std::swap(deck[i], deck[i + bounded(rng, left - i)]);
+            full.add(Card::fromIndex(deck[i]));
+        }
+        uint32_t hero = HandEvaluator::evaluate(hole | full);
+        int points = 0;
+        uint32_t range = left - missing;
+        for (int o = 0; o < opponents; o++) {
+            uint32_t first = bounded(rng, range);
+            uint32_t second = bounded(rng, range - 1);
+            if (second >= first) second++;
+            uint32_t villain = HandEvaluator::evaluate(full | CardSet(Card::fromIndex(deck[missing + first]))
+                                                       | CardSet(Card::fromIndex(deck[missing + second])));
+            points += hero > villain ? 2 : hero == villain ? 1 : 0;
+        }
+        return points;
+    }
+
+    int weight() const { return HandIndexer::weight(hole, board); }
+};
+
+// Cumulative histogram without its last bin (always 1)
+void cumulative(const uint8_t* histogram, float scale, float* out) {
+    float sum = 0.0f;
+    for (int bin = 0; bin < HISTOGRAM_BINS - 1; bin++) {
+        sum += histogram[bin];
+        out[bin] = sum * scale;
+    }
+}
+
+float meanEquity(const float* cdf) {
+    // Bin b holds equities in [b, b + 1) / HISTOGRAM_BINS; count it at its center
+    float mean = 0.0f, below = 0.0f;
+    for (int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+        float atOrBelow = bin < HISTOGRAM_BINS - 1 ? cdf[bin] : 1.0f;
+        mean += (atOrBelow - below) * (bin + 0.5f) / HISTOGRAM_BINS;
+        below = atOrBelow;
+    }
+    return mean;
+}
+
+uint64_t before(const std::vector<uint64_t>& weights, int level) {
+    return std::accumulate(weights.begin(), weights.begin() + level, uint64_t(0));
+}
+
+// Quantile cluster of a level, given twice the weight below its midpoint
+uint8_t quantileCluster(uint64_t doubledBelow, uint64_t total) {
+    return static_cast<uint8_t>(std::min<uint64_t>(STRATEGY_BUCKETS - 1, doubledBelow * STRATEGY_BUCKETS / (2 * total)));
+}
+
+// Renumbers clusters by ascending mean so bucket order follows strength
+std::vector<uint8_t> orderByMean(const std::vector<float>& means) {
+    std::vector<int> order(means.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return means[a] < means[b]; });
+    std::vector<uint8_t> rank(means.size());
+    for (size_t i = 0; i < order.size(); i++) rank[order[i]] = static_cast<uint8_t>(i);
+    return rank;
+}
+
+// Flop or turn: equity histograms, clustered on their cumulative form
+std::vector<uint8_t> bucketHistograms(int boardCards, const Settings& settings) {
+    const int DIMENSIONS = HISTOGRAM_BINS - 1;
+    uint32_t classes = HandIndexer::size(boardCards);
+    std::vector<uint8_t> histograms(static_cast<size_t>(classes) * HISTOGRAM_BINS);
+    std::vector<uint8_t> weights(classes);
+    int pointsPerRunout = 2 * settings.opponents;
+
+    auto start = std::chrono::steady_clock::now();
+    parallelBlocks(classes, settings.threads, [&](int, uint32_t block, uint32_t first, uint32_t last) {
+        Rng rng = blockRng(boardCards, block);
+        for (uint32_t index = first; index < last; index++) {
+            Sampler sampler(boardCards, index);
+            uint8_t* histogram = &histograms[static_cast<size_t>(index) * HISTOGRAM_BINS];
+            for (int r = 0; r < settings.runouts; r++) {
+                int bin = sampler.points(settings.opponents, rng) * HISTOGRAM_BINS / pointsPerRunout;
+                histogram[std::min(bin, HISTOGRAM_BINS - 1)]++;
+            }
+            weights[index] = static_cast<uint8_t>(sampler.weight());
+        }
+    });
+    double sampleSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Start from weighted quantiles of mean equity: clusters of equal weight along the strength axis
+    float scale = 1.0f / settings.runouts;
+    std::vector<uint8_t> assignment(classes);
+    {
+        std::vector<uint64_t> levels(RIVER_LEVELS);
+        std::vector<uint8_t> level(classes);
+        for (uint32_t index = 0; index < classes; index++) {
+            float cdf[DIMENSIONS];
+            cumulative(&histograms[static_cast<size_t>(index) * HISTOGRAM_BINS], scale, cdf);
+            level[index] = static_cast<uint8_t>(std::min(RIVER_LEVELS - 1, static_cast<int>(meanEquity(cdf) * RIVER_LEVELS)));
+            levels[level[index]] += weights[index];
+        }
+        uint64_t total = std::accumulate(levels.begin(), levels.end(), uint64_t(0));
+        uint8_t clusterOf[RIVER_LEVELS];
+        for (int l = 0; l < RIVER_LEVELS; l++) {
+            clusterOf[l] = quantileCluster(before(levels, l) * 2 + levels[l], total);
+        }
+        for (uint32_t index = 0; index < classes; index++) assignment[index] = clusterOf[level[index]];
+    }
+
+    // Lloyd iterations; integer sums of weight * histogram make centroids independent of the thread split
+    struct Sums {
+        uint64_t weight[STRATEGY_BUCKETS] = {};
+        uint64_t cumulative[STRATEGY_BUCKETS][DIMENSIONS] = {};
+        uint64_t moved = 0;
+    };
+    auto accumulate = [&](Sums& sums, uint32_t index, int cluster) {
+        const uint8_t* histogram = &histograms[static_cast<size_t>(index) * HISTOGRAM_BINS];
+        uint64_t count = 0;
+        sums.weight[cluster] += weights[index];
+        for (int d = 0; d < DIMENSIONS; d++) {
+            count += histogram[d];
+            sums.cumulative[cluster][d] += count * weights[index];
+        }
+    };
+    std::vector<float> centroids(STRATEGY_BUCKETS * DIMENSIONS);
+    auto updateCentroids = [&](const Sums& sums) {
+        for (int c = 0; c < STRATEGY_BUCKETS; c++) {
+            if (sums.weight[c] == 0) continue;   // Empty cluster keeps its centroid
+            for (int d = 0; d < DIMENSIONS; d++) {
+                centroids[c * DIMENSIONS + d] = static_cast<float>(
+                    static_cast<double>(sums.cumulative[c][d]) / (static_cast<double>(sums.weight[c]) * settings.runouts));
+            }
+        }
+    };
+    {
+        Sums initial;
+        for (uint32_t index = 0; index < classes; index++) accumulate(initial, index, assignment[index]);
+        updateCentroids(initial);
+    }
+
+    uint64_t totalWeight = 0;
+    for (uint8_t weight : weights) totalWeight += weight;
+    int iterations = 0;
+    while (iterations < KMEANS_MAX_ITERATIONS) {
+        iterations++;
+        std::vector<Sums> perThread(settings.threads);
+        parallelBlocks(classes, settings.threads, [&](int thread, uint32_t, uint32_t first, uint32_t last) {
+            Sums& sums = perThread[thread];
+            for (uint32_t index = first; index < last; index++) {
+                float cdf[DIMENSIONS];
+                cumulative(&histograms[static_cast<size_t>(index) * HISTOGRAM_BINS], scale, cdf);
+                int best = 0;
+                float bestDistance = 0.0f;
+                for (int c = 0; c < STRATEGY_BUCKETS; c++) {
+                    float distance = 0.0f;
+                    for (int d = 0; d < DIMENSIONS; d++) {
+                        float delta = cdf[d] - centroids[c * DIMENSIONS + d];
+                        distance += delta * delta;
+                    }
+                    if (c == 0 || distance < bestDistance) {
+                        best = c;
+                        bestDistance = distance;
+                    }
+                }
+                if (best != assignment[index]) {
+                    sums.moved += weights[index];
+                    assignment[index] = static_cast<uint8_t>(best);
+                }
+                accumulate(sums, index, best);
+            }
+        });
+        Sums merged;
+        for (const Sums& sums : perThread) {
+            merged.moved += sums.moved;
+            for (int c = 0; c < STRATEGY_BUCKETS; c++) {
+                merged.weight[c] += sums.weight[c];
+                for (int d = 0; d < DIMENSIONS; d++) merged.cumulative[c][d] += sums.cumulative[c][d];
+            }
+        }
+        updateCentroids(merged);
+        if (merged.moved <= KMEANS_TOLERANCE * totalWeight) break;
+    }
+
+    std::vector<float> means(STRATEGY_BUCKETS);
+    for (int c = 0; c < STRATEGY_BUCKETS; c++) means[c] = meanEquity(&centroids[c * DIMENSIONS]);
+    std::vector<uint8_t> rank = orderByMean(means);
+    for (uint8_t& cluster : assignment) cluster = rank[cluster];
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::fixed << std::setprecision(2) << (boardCards == 3 ? "Flop" : "Turn") << ": " << classes
+              << " classes, sampled in " << sampleSeconds << " s, k-means " << iterations << " iterations, "
+              << seconds << " s total\n";
+    return assignment;
+}
+
+// River: one equity per class, clustered in one dimension over its RIVER_LEVELS values
+std::vector<uint8_t> bucketRiver(const Settings& settings) {
+    const int BOARD_CARDS = HandIndexer::MAX_BOARD_CARDS;
+    uint32_t classes = HandIndexer::size(BOARD_CARDS);
+    std::vector<uint8_t> levels(classes);   // Equity level per class, then its bucket
+    std::vector<std::vector<uint64_t>> perThread(settings.threads, std::vector<uint64_t>(RIVER_LEVELS));
+    int opponents = settings.runouts * settings.opponents;
+
+    auto start = std::chrono::steady_clock::now();
+    parallelBlocks(classes, settings.threads, [&](int thread, uint32_t block, uint32_t first, uint32_t last) {
+        Rng rng = blockRng(BOARD_CARDS, block);
+        for (uint32_t index = first; index < last; index++) {
+            Sampler sampler(BOARD_CARDS, index);
+            int level = (sampler.points(opponents, rng) * (RIVER_LEVELS - 1) + opponents) / (2 * opponents);
+            levels[index] = static_cast<uint8_t>(level);
+            perThread[thread][level] += sampler.weight();
+        }
+    });
+    double sampleSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<uint64_t> weight(RIVER_LEVELS);
+    for (const auto& counts : perThread) {
+        for (int l = 0; l < RIVER_LEVELS; l++) weight[l] += counts[l];
+    }
+    uint64_t total = std::accumulate(weight.begin(), weight.end(), uint64_t(0));
+
+    // Weighted quantiles to start, then Lloyd over the levels
+    std::vector<double> centroids(STRATEGY_BUCKETS);
+    uint8_t clusterOf[RIVER_LEVELS];
+    for (int l = 0; l < RIVER_LEVELS; l++) {
+        clusterOf[l] = quantileCluster(before(weight, l) * 2 + weight[l], total);
+    }
+    int iterations = 0;
+    bool moved = true;
+    while (moved && iterations < KMEANS_MAX_ITERATIONS) {
+        iterations++;
+        double sums[STRATEGY_BUCKETS] = {}, weights[STRATEGY_BUCKETS] = {};
+        for (int l = 0; l < RIVER_LEVELS; l++) {
+            sums[clusterOf[l]] += static_cast<double>(weight[l]) * l;
+            weights[clusterOf[l]] += static_cast<double>(weight[l]);
+        }
+        for (int c = 0; c < STRATEGY_BUCKETS; c++) {
+            if (weights[c] > 0) centroids[c] = sums[c] / weights[c];
+        }
+        moved = false;
+        for (int l = 0; l < RIVER_LEVELS; l++) {
+            int best = 0;
+            for (int c = 1; c < STRATEGY_BUCKETS; c++) {
+                if (std::abs(l - centroids[c]) < std::abs(l - centroids[best])) best = c;
+            }
+            moved = moved || best != clusterOf[l];
+            clusterOf[l] = static_cast<uint8_t>(best);
+        }
+    }
+    std::vector<float> means(centroids.begin(), centroids.end());
+    std::vector<uint8_t> rank = orderByMean(means);
+    for (uint8_t& level : levels) level = rank[clusterOf[level]];
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::fixed << std::setprecision(2) << "River: " << classes << " classes, sampled in "
+              << sampleSeconds << " s, k-means " << iterations << " iterations, " << seconds << " s total\n";
+    return levels;
+}
+
+// FNV-1a over the bucket bytes; main() turns 0 (no bucket table) into 1
+uint32_t hashBuckets(uint32_t hash, const std::vector<uint8_t>& buckets) {
+    for (uint8_t bucket : buckets) hash = (hash ^ bucket) * 16777619u;
+    return hash;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string outputPath = argc > 1 ? argv[1] : "buckets.bgb";
+    Settings settings;
+    if (argc > 2) settings.runouts = std::clamp(std::atoi(argv[2]), 1, 255);
+    if (argc > 3) settings.opponents = std::clamp(std::atoi(argv[3]), 1, 255);
+    settings.threads = argc > 4 ? std::atoi(argv[4]) : 0;
+    if (settings.threads <= 0) settings.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    std::ofstream out(outputPath, std::ios::binary);
+    BucketFileHeader header = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto start = std::chrono::steady_clock::now();
+    uint32_t hash = 2166136261u;
+    for (int boardCards = HandIndexer::MIN_BOARD_CARDS; boardCards <= HandIndexer::MAX_BOARD_CARDS; boardCards++) {
+        std::vector<uint8_t> buckets = boardCards < HandIndexer::MAX_BOARD_CARDS ? bucketHistograms(boardCards, settings)
+                                                                                 : bucketRiver(settings);
+        std::vector<uint64_t> share(STRATEGY_BUCKETS);
+        for (uint8_t bucket : buckets) share[bucket]++;
+        std::cout << "  classes per bucket:";
+        for (uint64_t count : share) std::cout << " " << count;
+        std::cout << "\n";
+
+        hash = hashBuckets(hash, buckets);
+        header.classes[boardCards - HandIndexer::MIN_BOARD_CARDS] = static_cast<uint32_t>(buckets.size());
+        out.write(reinterpret_cast<const char*>(buckets.data()), static_cast<std::streamsize>(buckets.size()));
+    }
+
+    std::memcpy(header.magic, BUCKET_MAGIC, sizeof(header.magic));
+    header.version = BUCKET_VERSION;
+    header.streets = BUCKET_STREETS;
+    header.buckets = STRATEGY_BUCKETS;
+    header.runouts = static_cast<uint16_t>(settings.runouts);
+    header.opponents = static_cast<uint16_t>(settings.opponents);
+    header.id = hash ? hash : 1;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!out) {
+        std::cerr << "Cannot write " << outputPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::fixed << std::setprecision(2) << "Wrote " << outputPath << " (id " << std::hex << header.id
+              << std::dec << ") in " << seconds << " s on " << settings.threads << " threads\n";
+    return EXIT_SUCCESS;
+}
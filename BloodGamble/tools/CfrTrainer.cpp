@@ -0,0 +1,346 @@
+// Offline MCCFR trainer for the strategy table AIPlayer maps with --strategy
+// Usage: CfrTrainer [iterations] [output path] [threads, 0 for all] [bucket table]
+//
+// Heads-up abstraction of a BloodGamble hand: HP_AI_INIT stacks, the real
+// blinds, seat 0 (small blind) first to act on every street as in
+// BloodGambleGame, and per street at most STRATEGY_MAX_RAISES raises of MIN_BET
+// or MAX_BET on top of the call, or all-in. Cards are seen only through
+// AIPlayer::strengthBucket, the same key the runtime uses: quickStrength, or
+// the BucketGen table postflop when one is given (the strategy records its id).
+//
+// External-sampling MCCFR: each iteration deals the cards, then for each
+// traverser enumerates its actions and samples chance and the opponent.
+// Worker threads share the regret and strategy-sum tables and update them with
+// relaxed compare-and-swap loops and no locks (lost races only add noise).
+#include "../include/ai/Strategy.h"
+#include "../include/ai/AIPlayer.h"
+#include "../include/ai/HandBuckets.h"
+#include "../include/core/HandEvaluator.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <cstring>
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+const int STRATEGY_MAX_RAISES = 2;
+const int RAISE_SIZES[STRATEGY_ACTIONS] = {0, 0, MIN_BET, MAX_BET, 0};
+
+template <typename T>
+void atomicAdd(std::atomic<T>& target, T delta) {
+    T current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, current + delta, std::memory_order_relaxed)) {
+    }
+}
+
+struct Tables {
+    std::unique_ptr<std::atomic<float>[]> regrets{new std::atomic<float>[STRATEGY_INFOSETS * STRATEGY_ACTIONS]};
+    std::unique_ptr<std::atomic<double>[]> strategySums{new std::atomic<double>[STRATEGY_INFOSETS * STRATEGY_ACTIONS]};
+
+    Tables() {
+        for (int i = 0; i < STRATEGY_INFOSETS * STRATEGY_ACTIONS; i++) {
+            regrets[i].store(0.0f, std::memory_order_relaxed);
+            strategySums[i].store(0.0, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Cards of one iteration: both hands, the full board and every bucket
+struct Deal {
+    uint32_t strength[2];
+    int bucket[2][STRATEGY_STREETS];
+};
+
+struct Node {
+    int street = 0;
+    int pot = SMALL_BLIND + BIG_BLIND;
+    int stack[2] = {HP_AI_INIT - SMALL_BLIND, HP_AI_INIT - BIG_BLIND};
+    int bet[2] = {SMALL_BLIND, BIG_BLIND};
+    int toAct = 0;
+    int acted = 0;      // Seat bits that acted since the last raise
+    int raises = 0;
+    int folded = -1;    // Seat that folded, ending the hand
+    bool showdown = false;
+
+    int callAmount() const { return std::max(bet[0], bet[1]) - bet[toAct]; }
+
+    // Legal actions as a bit mask over StrategyAction
+    int legal() const {
+        int call = callAmount();
+        int mask = 1 << static_cast<int>(StrategyAction::CALL);
+        if (call > 0) mask |= 1 << static_cast<int>(StrategyAction::FOLD);
+        if (stack[1 - toAct] == 0 || stack[toAct] <= call) return mask;   // Nothing left to raise into
+        if (raises < STRATEGY_MAX_RAISES) {
+            if (stack[toAct] > call + MIN_BET) mask |= 1 << static_cast<int>(StrategyAction::RAISE_MIN);
+            if (stack[toAct] > call + MAX_BET) mask |= 1 << static_cast<int>(StrategyAction::RAISE_MAX);
+        }
+        return mask | 1 << static_cast<int>(StrategyAction::ALL_IN);
+    }
+
+    void commit(int seat, int amount) {
+        amount = std::min(amount, stack[seat]);
+        stack[seat] -= amount;
+        bet[seat] += amount;
+        pot += amount;
+    }
+
+    Node apply(int action) const {
+        Node next = *this;
+        int seat = toAct;
+        int high = std::max(bet[0], bet[1]);
+        switch (static_cast<StrategyAction>(action)) {
+            case StrategyAction::FOLD:
+                next.folded = seat;
+                return next;
+            case StrategyAction::CALL:
+                next.commit(seat, callAmount());
+                break;
+            case StrategyAction::ALL_IN:
+                next.commit(seat, stack[seat]);
+                break;
+            default:
+                next.commit(seat, callAmount() + RAISE_SIZES[action]);
+                break;
+        }
+        if (next.bet[seat] > high) {   // Reopens the action, as in BloodGambleGame::bettingRound
+            next.raises++;
+            next.acted = 0;
+        }
+        next.acted |= 1 << seat;
+        next.toAct = 1 - seat;
+        next.closeStreet();
+        return next;
+    }
+
+    // Ends the street once both seats acted at level bets (or cannot act), then deals on
+    void closeStreet() {
+        for (int seat = 0; seat < 2; seat++) {
+            bool canAct = stack[seat] > 0;
+            if (canAct && (!(acted & (1 << seat)) || bet[seat] != std::max(bet[0], bet[1]))) return;
+        }
+        if (street == STRATEGY_STREETS - 1 || stack[0] == 0 || stack[1] == 0) {
+            showdown = true;
+            return;
+        }
+        street++;
+        bet[0] = bet[1] = 0;
+        acted = 0;
+        raises = 0;
+        toAct = 0;
+    }
+
+    bool terminal() const { return folded >= 0 || showdown; }
+
+    // HP won or lost by `seat` over the hand, paid by splitPots as at the table; seat 0 sits
+    // after the dealer and takes odd chips
+    double utility(int seat, const Deal& deal) const {
+        int contributed[2] = {HP_AI_INIT - stack[0], HP_AI_INIT - stack[1]};
+        uint32_t contenders = folded >= 0 ? seatBit(1 - folded) : seatBit(0) | seatBit(1);
+        PotSplit split = splitPots(contributed, 2, contenders, deal.strength, 0);
+        return stack[seat] - HP_AI_INIT + split.won[seat] + split.refunded[seat];
+    }
+
+    int infoset(const Deal& deal) const {
+        return strategyIndex(street, deal.bucket[toAct][street], toAct, strategyCallClass(callAmount()),
+                             strategyPotClass(pot));
+    }
+};
+
+// Regret matching over the legal actions
+void currentStrategy(const Tables& tables, int infoset, int legal, double* strategy) {
+    double positive = 0.0;
+    int legalCount = 0;
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        strategy[a] = 0.0;
+        if (!(legal & (1 << a))) continue;
+        legalCount++;
+        strategy[a] = std::max(0.0f, tables.regrets[infoset * STRATEGY_ACTIONS + a].load(std::memory_order_relaxed));
+        positive += strategy[a];
+    }
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        if (!(legal & (1 << a))) continue;
+        strategy[a] = positive > 0.0 ? strategy[a] / positive : 1.0 / legalCount;
+    }
+}
+
+double traverse(Tables& tables, const Node& node, const Deal& deal, int traverser, Rng& rng) {
+    if (node.terminal()) return node.utility(traverser, deal);
+
+    int infoset = node.infoset(deal);
+    int legal = node.legal();
+    double strategy[STRATEGY_ACTIONS];
+    currentStrategy(tables, infoset, legal, strategy);
+
+    if (node.toAct == traverser) {
+        double values[STRATEGY_ACTIONS] = {};
+        double nodeValue = 0.0;
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+            if (!(legal & (1 << a))) continue;
+            values[a] = traverse(tables, node.apply(a), deal, traverser, rng);
+            nodeValue += strategy[a] * values[a];
+        }
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+            if (legal & (1 << a)) {
+                atomicAdd(tables.regrets[infoset * STRATEGY_ACTIONS + a], static_cast<float>(values[a] - nodeValue));
+            }
+        }
+        return nodeValue;
+    }
+
+    // Opponent node: accumulate the average strategy, then sample one action
+    double pick = uniform01(rng);
+    int chosen = -1, last = 0;
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        if (!(legal & (1 << a))) continue;
+        atomicAdd(tables.strategySums[infoset * STRATEGY_ACTIONS + a], strategy[a]);
+        if (chosen < 0 && (pick -= strategy[a]) < 0.0) chosen = a;
+        last = a;
+    }
+    if (chosen < 0) chosen = last;   // Rounding left pick just above zero
+    return traverse(tables, node.apply(chosen), deal, traverser, rng);
+}
+
+Deal dealCards(Rng& rng) {
+    uint8_t cards[Deck::DECK_SIZE];
+    CardSet deck = CardSet::fullDeck();
+    for (int i = 0; i < Deck::DECK_SIZE; i++) cards[i] = deck.popLowest().index();
+    for (int i = 0; i < 9; i++) {   // Partial Fisher-Yates: two hands and five board cards
+        std::swap(cards[i], cards[i + bounded(rng, Deck::DECK_SIZE - i)]);
+    }
+
+    Deal deal;
+    CardSet holes[2] = {CardSet(Card::fromIndex(cards[0])) | CardSet(Card::fromIndex(cards[1])),
+                        CardSet(Card::fromIndex(cards[2])) | CardSet(Card::fromIndex(cards[3]))};
+    for (int street = 0; street < STRATEGY_STREETS; street++) {
+        CardSet board;
+        int boardCards = street == 0 ? 0 : street + 2;
+        for (int i = 0; i < boardCards; i++) board.add(Card::fromIndex(cards[4 + i]));
+        for (int seat = 0; seat < 2; seat++) {
+            deal.bucket[seat][street] = AIPlayer::strengthBucket(holes[seat], board, 1);
+            if (street == STRATEGY_STREETS - 1) deal.strength[seat] = HandEvaluator::evaluate(holes[seat] | board);
+        }
+    }
+    return deal;
+}
+
+// Average strategy in 1/255 steps, largest remainders get the rounding slack;
+// false for an information set training never reached
+bool quantize(const Tables& tables, int infoset, uint8_t* row) {
+    double sums[STRATEGY_ACTIONS];
+    double total = 0.0;
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        sums[a] = tables.strategySums[infoset * STRATEGY_ACTIONS + a].load(std::memory_order_relaxed);
+        total += sums[a];
+    }
+    std::memset(row, 0, STRATEGY_ACTIONS);
+    if (total <= 0.0) return false;
+
+    int assigned = 0;
+    double remainders[STRATEGY_ACTIONS];
+    for (int a = 0; a < STRATEGY_ACTIONS; a++) {
+        double exact = sums[a] / total * 255.0;
+        row[a] = static_cast<uint8_t>(exact);
+        remainders[a] = exact - row[a];
+        assigned += row[a];
+    }
+    for (; assigned < 255; assigned++) {
+        int best = 0;
+        for (int a = 1; a < STRATEGY_ACTIONS; a++) {
+            if (remainders[a] > remainders[best]) best = a;
+        }
+        row[best]++;
+        remainders[best] = -1.0;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::string outputPath = argc > 2 ? argv[2] : "strategy.bgs";
+    int threads = argc > 3 ? std::atoi(argv[3]) : 0;
+    if (threads <= 0) threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::string error;
+    if (argc > 4 && !BucketTable::global().load(argv[4], error)) {
+        std::cerr << "Cannot load buckets: " << error << "\n";
+        return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Tables tables;
+    std::atomic<uint64_t> nextIteration{0};
+    auto work = [&](int thread) {
+        Rng rng(0xC0FFEE, static_cast<uint64_t>(thread));
+        const uint64_t BATCH = 1024;
+        uint64_t first;
+        while ((first = nextIteration.fetch_add(BATCH, std::memory_order_relaxed)) < iterations) {
+            for (uint64_t i = first; i < std::min(iterations, first + BATCH); i++) {
+                Deal deal = dealCards(rng);
+                for (int traverser = 0; traverser < 2; traverser++) {
+                    traverse(tables, Node(), deal, traverser, rng);
+                }
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+        workers.emplace_back(work, t);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<uint8_t> rows(static_cast<size_t>(STRATEGY_INFOSETS) * STRATEGY_ACTIONS);
+    int reached = 0;
+    for (int infoset = 0; infoset < STRATEGY_INFOSETS; infoset++) {
+        reached += quantize(tables, infoset, &rows[static_cast<size_t>(infoset) * STRATEGY_ACTIONS]);
+    }
+
+    StrategyFileHeader header = {};
+    std::memcpy(header.magic, STRATEGY_MAGIC, sizeof(header.magic));
+    header.version = STRATEGY_VERSION;
+    header.streets = STRATEGY_STREETS;
+    header.buckets = STRATEGY_BUCKETS;
+    header.positions = STRATEGY_POSITIONS;
+    header.callClasses = STRATEGY_CALL_CLASSES;
+    header.potClasses = STRATEGY_POT_CLASSES;
+    header.actions = STRATEGY_ACTIONS;
+    header.infosets = STRATEGY_INFOSETS;
+    header.iterations = iterations;
+    header.bucketTable = BucketTable::global().id();
+
+    std::ofstream out(outputPath, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(rows.data()), static_cast<std::streamsize>(rows.size()));
+    if (!out) {
+        std::cerr << "Cannot write " << outputPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::fixed << "Trained " << iterations << " iterations in " << std::setprecision(2) << seconds
+              << " s (" << std::setprecision(0) << iterations / seconds << " it/s, " << threads << " threads)\n";
+    std::cout << "Reached " << reached << " of " << STRATEGY_INFOSETS << " information sets\n";
+
+    // Opening decision of the small blind by bucket, as a quick sanity check
+    std::cout << "\nSmall blind opening, % fold/call/raise min/raise max/all-in\n";
+    for (int bucket = 0; bucket < STRATEGY_BUCKETS; bucket++) {
+        const uint8_t* row = &rows[static_cast<size_t>(strategyIndex(0, bucket, 0, strategyCallClass(BIG_BLIND - SMALL_BLIND),
+                                                                     strategyPotClass(SMALL_BLIND + BIG_BLIND))) * STRATEGY_ACTIONS];
+        if (std::count(row, row + STRATEGY_ACTIONS, 0) == STRATEGY_ACTIONS) continue;
+        std::cout << std::setw(6) << bucket;
+        for (int a = 0; a < STRATEGY_ACTIONS; a++) std::cout << std::setw(6) << row[a] * 100 / 255;
+        std::cout << "\n";
+    }
+    std::cout << "Wrote " << outputPath << "\n";
+    return EXIT_SUCCESS;
+}
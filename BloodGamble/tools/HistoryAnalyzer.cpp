@@ -0,0 +1,217 @@
+// Streaming statistics over binary hand-history logs (see include/game/HandHistory.h)
+// Usage: HistoryAnalyzer <log> [threads]
+#include "../include/core/MappedFile.h"
+#include "../include/core/HandEvaluator.h"
+#include "../include/game/HandHistory.h"
+#include "../include/game/CheatSystem.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+
+namespace {
+
+const int MAX_LOG_SEATS = 16;
+const int MAX_LOG_CHEATS = 32;
+const int HAND_RANKS = 10;
+const int CURVE_ROUNDS = 500;   // Vigilance curve length
+
+struct Stats {
+    uint64_t records = 0;
+    uint64_t games = 0;
+    uint64_t rounds = 0;
+    uint64_t showdownRounds = 0;
+    uint64_t dealt[MAX_LOG_SEATS] = {};
+    uint64_t potsWon[MAX_LOG_SEATS] = {};
+    uint64_t hpWon[MAX_LOG_SEATS] = {};
+    uint64_t shown[HAND_RANKS] = {};
+    uint64_t shownWon[HAND_RANKS] = {};
+    uint64_t cheatAttempts[MAX_LOG_CHEATS] = {};
+    uint64_t cheatDetected[MAX_LOG_CHEATS] = {};
+    uint64_t vigilanceMicros[CURVE_ROUNDS] = {};
+    uint64_t vigilanceRounds[CURVE_ROUNDS] = {};
+
+    void merge(const Stats& other) {
+        auto add = [](uint64_t* to, const uint64_t* from, int n) {
+            for (int i = 0; i < n; i++) to[i] += from[i];
+        };
+        records += other.records;
+        games += other.games;
+        rounds += other.rounds;
+        showdownRounds += other.showdownRounds;
+        add(dealt, other.dealt, MAX_LOG_SEATS);
+        add(potsWon, other.potsWon, MAX_LOG_SEATS);
+        add(hpWon, other.hpWon, MAX_LOG_SEATS);
+        add(shown, other.shown, HAND_RANKS);
+        add(shownWon, other.shownWon, HAND_RANKS);
+        add(cheatAttempts, other.cheatAttempts, MAX_LOG_CHEATS);
+        add(cheatDetected, other.cheatDetected, MAX_LOG_CHEATS);
+        add(vigilanceMicros, other.vigilanceMicros, CURVE_ROUNDS);
+        add(vigilanceRounds, other.vigilanceRounds, CURVE_ROUNDS);
+    }
+};
+
+// Rounds never span two chunks: a chunk starts at its first round boundary
+// and runs past its end up to the next one
+bool startsRound(const HistoryRecord& r) {
+    return r.type == RecordType::ROUND_START || r.type == RecordType::GAME_START;
+}
+
+void scan(const HistoryRecord* records, size_t count, size_t begin, size_t end, Stats& stats) {
+    if (begin > 0) {
+        while (begin < count && !startsRound(records[begin])) begin++;
+    }
+
+    int8_t shownRank[MAX_LOG_SEATS];
+    std::memset(shownRank, -1, sizeof(shownRank));
+    bool showdown = false;
+
+    size_t i = begin;
+    for (; i < count; i++) {
+        const HistoryRecord& r = records[i];
+        if (i >= end && startsRound(r)) break;
+
+        uint8_t seat = r.seat & (MAX_LOG_SEATS - 1);
+        switch (r.type) {
+            case RecordType::GAME_START:
+                stats.games++;
+                break;
+            case RecordType::ROUND_START:
+                stats.rounds++;
+                if (r.round > 0 && r.round <= CURVE_ROUNDS) {
+                    stats.vigilanceMicros[r.round - 1] += r.value;
+                    stats.vigilanceRounds[r.round - 1]++;
+                }
+                std::memset(shownRank, -1, sizeof(shownRank));
+                showdown = false;
+                break;
+            case RecordType::DEAL:
+                stats.dealt[seat]++;
+                break;
+            case RecordType::CHEAT:
+                stats.cheatAttempts[r.code & (MAX_LOG_CHEATS - 1)]++;
+                stats.cheatDetected[r.code & (MAX_LOG_CHEATS - 1)] += r.flag;
+                break;
+            case RecordType::SHOWDOWN:
+                if (r.code < HAND_RANKS) {
+                    stats.shown[r.code]++;
+                    shownRank[seat] = static_cast<int8_t>(r.code);
+                }
+                stats.showdownRounds += !showdown;
+                showdown = true;
+                break;
+            case RecordType::AWARD:
+                stats.potsWon[seat]++;
+                stats.hpWon[seat] += static_cast<uint64_t>(r.amount);
+                if (shownRank[seat] >= 0) stats.shownWon[shownRank[seat]]++;
+                break;
+            default:
+                break;
+        }
+    }
+    stats.records += i - begin;
+}
+
+const char* RANK_NAMES[HAND_RANKS] = {
+    "High card", "Pair", "Two pair", "Three of a kind", "Straight",
+    "Flush", "Full house", "Four of a kind", "Straight flush", "Royal flush"
+};
+
+void report(const Stats& stats, std::ostream& out) {
+    auto percent = [](uint64_t part, uint64_t whole) { return whole ? 100.0 * part / whole : 0.0; };
+    out << std::fixed;
+
+    out << "Games: " << stats.games << " | Rounds: " << stats.rounds << " | Records: " << stats.records << "\n";
+    out << "Showdown rounds: " << std::setprecision(2) << percent(stats.showdownRounds, stats.rounds) << "%\n";
+
+    out << "\nSeat    Dealt   Pots won   Avg pot\n";
+    for (int seat = 0; seat < MAX_LOG_SEATS; seat++) {
+        if (stats.dealt[seat] == 0 && stats.potsWon[seat] == 0) continue;
+        out << std::setw(4) << seat << std::setw(9) << stats.dealt[seat] << std::setw(10)
+            << percent(stats.potsWon[seat], stats.dealt[seat]) << "%" << std::setw(10)
+            << (stats.potsWon[seat] ? static_cast<double>(stats.hpWon[seat]) / stats.potsWon[seat] : 0.0) << "\n";
+    }
+
+    uint64_t shownTotal = 0;
+    for (uint64_t shown : stats.shown) shownTotal += shown;
+    out << "\nShowdown hand       Shown      Won\n";
+    for (int rank = 0; rank < HAND_RANKS; rank++) {
+        out << std::left << std::setw(16) << RANK_NAMES[rank] << std::right << std::setw(9)
+            << percent(stats.shown[rank], shownTotal) << "%" << std::setw(8)
+            << percent(stats.shownWon[rank], stats.shown[rank]) << "%\n";
+    }
+
+    out << "\nCheat               Attempts  Success  Detected\n";
+    for (int id = 0; id < MAX_LOG_CHEATS; id++) {
+        if (stats.cheatAttempts[id] == 0) continue;
+        const CheatType* cheat = CheatSystem::getCheatById(id);
+        uint64_t detected = stats.cheatDetected[id];
+        out << std::left << std::setw(18) << (cheat ? cheat->name : "#" + std::to_string(id)) << std::right
+            << std::setw(10) << stats.cheatAttempts[id]
+            << std::setw(8) << percent(stats.cheatAttempts[id] - detected, stats.cheatAttempts[id]) << "%"
+            << std::setw(9) << percent(detected, stats.cheatAttempts[id]) << "%\n";
+    }
+
+    out << "\nRound   Games  Avg vigilance\n";
+    for (int round : {1, 5, 10, 25, 50, 100, 200, CURVE_ROUNDS}) {
+        uint64_t games = stats.vigilanceRounds[round - 1];
+        if (games == 0) continue;
+        out << std::setw(5) << round << std::setw(8) << games << std::setw(15) << std::setprecision(4)
+            << stats.vigilanceMicros[round - 1] / 1e6 / games << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <hand history> [threads]\n";
+        return EXIT_FAILURE;
+    }
+    int threads = argc > 2 ? std::atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, threads);
+
+    auto start = std::chrono::steady_clock::now();
+    MappedFile file;
+    if (!file.open(argv[1]) || file.size() < sizeof(HistoryFileHeader)) {
+        std::cerr << "Cannot map " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+
+    HistoryFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, HISTORY_MAGIC, sizeof(header.magic)) != 0 || header.version != HISTORY_VERSION
+        || header.recordSize != sizeof(HistoryRecord)) {
+        std::cerr << argv[1] << " is not a version " << HISTORY_VERSION << " hand history\n";
+        return EXIT_FAILURE;
+    }
+
+    // The header keeps records 16-byte aligned inside the page-aligned mapping
+    const HistoryRecord* records = reinterpret_cast<const HistoryRecord*>(file.data() + sizeof(header));
+    size_t count = (file.size() - sizeof(header)) / sizeof(HistoryRecord);
+
+    std::vector<Stats> partials(threads);
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+        workers.emplace_back(scan, records, count, count * t / threads, count * (t + 1) / threads, std::ref(partials[t]));
+    }
+    scan(records, count, 0, count / threads, partials[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Stats total;
+    for (const auto& partial : partials) {
+        total.merge(partial);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    report(total, std::cout);
+    std::cout << "\nScanned " << std::setprecision(1) << file.size() / 1e6 << " MB in " << std::setprecision(3)
+              << seconds << " s (" << std::setprecision(2) << file.size() / 1e9 / seconds << " GB/s, "
+              << threads << " threads)\n";
+    return EXIT_SUCCESS;
+}
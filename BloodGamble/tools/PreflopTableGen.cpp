@@ -0,0 +1,80 @@
+// Offline generator for include/ai/PreflopEquityTable.h
+// Usage: PreflopTableGen [samples per entry] [output path]
+#include "../include/ai/EquityEngine.h"
+#include "../include/ai/PreflopTable.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <cstdlib>
+
+namespace {
+
+const char RANK_CHARS[] = "23456789TJQKA";
+
+std::string handName(int high, int low, bool suited) {
+    std::string name{RANK_CHARS[high], RANK_CHARS[low]};
+    if (high != low) name += suited ? "s" : "o";
+    return name;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint64_t samples = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::string outputPath = argc > 2 ? argv[2] : "include/ai/PreflopEquityTable.h";
+
+    EquityEngine::Settings settings;
+    settings.threads = std::max(1u, std::thread::hardware_concurrency());
+    settings.maxSamples = samples;
+    settings.targetError = 0.0; // Always run every sample
+
+    double equity[PREFLOP_HAND_CLASSES][PREFLOP_MAX_OPPONENTS];
+    std::string names[PREFLOP_HAND_CLASSES];
+
+    for (int high = 0; high < 13; high++) {
+        for (int low = 0; low <= high; low++) {
+            for (bool suited : {false, true}) {
+                if (suited && high == low) continue;
+
+                int index = preflopHandIndex(high, low, suited);
+                CardSet hole(Card(Suit::HEARTS, static_cast<Rank>(high + 2)));
+                hole.add(Card(suited ? Suit::HEARTS : Suit::SPADES, static_cast<Rank>(low + 2)));
+                names[index] = handName(high, low, suited);
+
+                for (int opponents = 1; opponents <= PREFLOP_MAX_OPPONENTS; opponents++) {
+                    settings.seed = static_cast<uint64_t>(index) * PREFLOP_MAX_OPPONENTS + opponents;
+                    equity[index][opponents - 1] = EquityEngine::estimate(hole, CardSet(), opponents, settings).equity;
+                }
+                std::cerr << names[index] << std::fixed << std::setprecision(4);
+                for (int opponents = 0; opponents < PREFLOP_MAX_OPPONENTS; opponents++) {
+                    std::cerr << " " << equity[index][opponents];
+                }
+                std::cerr << "\n";
+            }
+        }
+    }
+
+    std::ofstream out(outputPath);
+    if (!out) {
+        std::cerr << "Cannot write " << outputPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    out << "#pragma once\n\n";
+    out << "// Generated by tools/PreflopTableGen.cpp (" << samples << " samples per entry). Do not edit.\n";
+    out << "// Equity of each starting hand against 1 to " << PREFLOP_MAX_OPPONENTS
+        << " random opponents, see PreflopTable.h\n";
+    out << "constexpr float PREFLOP_EQUITY[PREFLOP_HAND_CLASSES][PREFLOP_MAX_OPPONENTS] = {\n";
+    out << std::fixed << std::setprecision(4);
+    for (int index = 0; index < PREFLOP_HAND_CLASSES; index++) {
+        out << "    {";
+        for (int opponents = 0; opponents < PREFLOP_MAX_OPPONENTS; opponents++) {
+            out << (opponents ? ", " : "") << equity[index][opponents] << "f";
+        }
+        out << "}, // " << names[index] << "\n";
+    }
+    out << "};\n";
+    return EXIT_SUCCESS;
+}